@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup OHIPCMetrics
+ * @{
+ *
+ * @brief Provides C interfaces for collecting per-transaction IPC metrics.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @since 21
+ */
+
+/**
+ * @file ipc_cmetrics.h
+ *
+ * @brief Defines C interfaces for collecting call counts, data sizes, latency and queueing delay of
+ * IPC transactions, keyed by interface descriptor and command word.
+ *
+ * @library libipc_capi.so
+ * @kit IPCKit
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @since 21
+ */
+
+#ifndef CAPI_INCLUDE_IPC_CMETRICS_H
+#define CAPI_INCLUDE_IPC_CMETRICS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Defines the number of buckets of a latency histogram.
+ *
+ * @since 21
+ */
+#define OH_IPC_LATENCY_BUCKET_NUM 20
+
+/**
+ * @brief Enumerates the sides on which a transaction is measured.
+ *
+ * @since 21
+ */
+typedef enum {
+    /** Measured by {@link OH_IPCRemoteProxy_SendRequest} on the client. */
+    OH_IPC_METRICS_SIDE_PROXY = 0,
+    /** Measured by the <b>OHIPCRemoteStub</b> object on the server. */
+    OH_IPC_METRICS_SIDE_STUB = 1,
+} OH_IPC_MetricsSide;
+
+/**
+ * @brief Defines the metrics of one command word of one interface on one side.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Interface descriptor, which is valid until {@link OH_IPCMetrics_Reset} is called. */
+    const char *descriptor;
+    /** Custom command word. */
+    uint32_t code;
+    /** Side on which the transaction is measured. */
+    OH_IPC_MetricsSide side;
+    /** Number of calls. */
+    uint64_t calls;
+    /** Number of calls that returned an error code. */
+    uint64_t errors;
+    /** Total size of the request data, in bytes. */
+    uint64_t requestBytes;
+    /** Total size of the reply data, in bytes. */
+    uint64_t replyBytes;
+    /** Total latency, in microseconds. On the proxy it covers the round trip; on the stub, the callback. */
+    uint64_t totalLatencyUs;
+    /** Maximum latency, in microseconds. */
+    uint64_t maxLatencyUs;
+    /** Latency histogram. Bucket <b>i</b> counts calls with latency in [2^i, 2^(i+1)) microseconds,
+     *  and the last bucket also counts all longer calls. */
+    uint64_t latencyHistogram[OH_IPC_LATENCY_BUCKET_NUM];
+    /** Total time the requests waited before a work thread picked them up, in microseconds. Stub side only. */
+    uint64_t totalQueueUs;
+    /** Maximum time a request waited before a work thread picked it up, in microseconds. Stub side only. */
+    uint64_t maxQueueUs;
+} OH_IPC_TransactionMetrics;
+
+/**
+ * @brief Called for each entry when metrics are traversed.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param metrics Pointer to the metrics entry, which is valid only in the function.
+ * @param userData Pointer to the user data. It can be NULL.
+ * @since 21
+ */
+typedef void (*OH_OnIPCMetricsCallback)(const OH_IPC_TransactionMetrics *metrics, void *userData);
+
+/**
+ * @brief Enables or disables the collection of transaction metrics in this process.
+ *
+ * Collection is disabled by default.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param enable Whether to collect transaction metrics.
+ * @since 21
+ */
+void OH_IPCMetrics_Enable(bool enable);
+
+/**
+ * @brief Obtains the metrics of one command word of one interface.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param descriptor Pointer to the interface descriptor. It cannot be NULL.
+ * @param code Custom command word, in the range [0x01, 0x00ffffff].
+ * @param side Side on which the transaction is measured.
+ * @param metrics Pointer to the metrics to be filled in. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found
+ * or no transaction has been recorded for the key.
+ * @since 21
+ */
+int OH_IPCMetrics_Get(const char *descriptor, uint32_t code, OH_IPC_MetricsSide side,
+    OH_IPC_TransactionMetrics *metrics);
+
+/**
+ * @brief Traverses the metrics of all recorded transactions.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param callback Callback invoked for each entry. It cannot be NULL.
+ * @param userData Pointer to the user data. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 21
+ */
+int OH_IPCMetrics_Traverse(OH_OnIPCMetricsCallback callback, void *userData);
+
+/**
+ * @brief Emits the current metrics as HiTrace counters.
+ *
+ * Each entry produces the counters <b>IPC:<descriptor>:<code>:<proxy|stub>:calls</b>, <b>:bytes</b>
+ * and <b>:latency_us</b> through OH_HiTrace_CountTraceEx, so they can be read together with the trace.
+ * The counters <b>IPC:work_thread_num</b> and <b>IPC:busy_work_thread_num</b> report the worker thread pool.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR} if tracing is not enabled.
+ * @since 21
+ */
+int OH_IPCMetrics_EmitTraceCounters(void);
+
+/**
+ * @brief Clears all recorded metrics.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @since 21
+ */
+void OH_IPCMetrics_Reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+#endif
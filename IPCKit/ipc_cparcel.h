@@ -37,6 +37,7 @@
 #ifndef CAPI_INCLUDE_IPC_CPARCEL_H
 #define CAPI_INCLUDE_IPC_CPARCEL_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -91,6 +92,87 @@ struct OHIPCRemoteStub;
 */
 typedef struct OHIPCRemoteStub OHIPCRemoteStub;
 
+/**
+ * @brief Defines a memory segment filled by vectored reads.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Start address of the segment. */
+    void *base;
+    /** Length of the segment, in bytes. */
+    int32_t len;
+} OH_IPC_IoVec;
+
+/**
+ * @brief Defines a read-only memory segment used by vectored writes.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Start address of the segment. */
+    const void *base;
+    /** Length of the segment, in bytes. */
+    int32_t len;
+} OH_IPC_ConstIoVec;
+
+/**
+* @brief Defines a compiled serialization layout of a fixed C struct.
+*
+* @syscap SystemCapability.Communication.IPC.Core
+* @since 21
+*/
+struct OHIPCCodec;
+
+/**
+* @brief Typedef a compiled serialization layout of a fixed C struct.
+*
+* @syscap SystemCapability.Communication.IPC.Core
+* @since 21
+*/
+typedef struct OHIPCCodec OHIPCCodec;
+
+/**
+ * @brief Enumerates the field types supported by <b>OHIPCCodec</b>.
+ *
+ * Each type is encoded as the matching <b>OH_IPCParcel_Write*</b> function does, so a message written
+ * with a codec can be read field by field, and the other way around.
+ *
+ * @since 21
+ */
+typedef enum {
+    /** int8_t, encoded as by {@link OH_IPCParcel_WriteInt8}. */
+    OH_IPC_CODEC_FIELD_INT8 = 0,
+    /** int16_t, encoded as by {@link OH_IPCParcel_WriteInt16}. */
+    OH_IPC_CODEC_FIELD_INT16 = 1,
+    /** int32_t, encoded as by {@link OH_IPCParcel_WriteInt32}. */
+    OH_IPC_CODEC_FIELD_INT32 = 2,
+    /** int64_t, encoded as by {@link OH_IPCParcel_WriteInt64}. */
+    OH_IPC_CODEC_FIELD_INT64 = 3,
+    /** float, encoded as by {@link OH_IPCParcel_WriteFloat}. */
+    OH_IPC_CODEC_FIELD_FLOAT = 4,
+    /** double, encoded as by {@link OH_IPCParcel_WriteDouble}. */
+    OH_IPC_CODEC_FIELD_DOUBLE = 5,
+    /** Fixed-size byte array, encoded inline as by {@link OH_IPCParcel_WriteBuffer} with no shared memory
+     *  threshold set. The threshold set by {@link OH_IPCParcel_SetSharedMemoryThreshold} does not apply. */
+    OH_IPC_CODEC_FIELD_BYTES = 6,
+} OH_IPC_CodecFieldType;
+
+/**
+ * @brief Defines a field of a fixed C struct.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Type of the field. */
+    OH_IPC_CodecFieldType type;
+    /** Offset of the field in the struct, as given by <b>offsetof</b>. */
+    uint32_t offset;
+    /** Number of elements for an array field, or the number of bytes for
+     *  {@link OH_IPC_CodecFieldType#OH_IPC_CODEC_FIELD_BYTES}. The value <b>1</b> means a scalar field. */
+    uint32_t count;
+} OH_IPC_CodecField;
+
 /**
  * @brief Allocates memory.
  *
@@ -120,6 +202,74 @@ OHIPCParcel* OH_IPCParcel_Create(void);
  */
 void OH_IPCParcel_Destroy(OHIPCParcel *parcel);
 
+/**
+ * @brief Obtains an <b>OHIPCParcel</b> object from the parcel pool of the calling thread.
+ *
+ * A pooled object keeps the capacity it has grown to, so reusing it avoids reallocating its buffer.
+ * If the pool is empty, a new object is created as {@link OH_IPCParcel_Create} does.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @return Returns the pointer to an empty <b>OHIPCParcel</b> object if the operation is successful;
+ * returns NULL otherwise.
+ * @since 21
+ */
+OHIPCParcel* OH_IPCParcel_Obtain(void);
+
+/**
+ * @brief Returns an <b>OHIPCParcel</b> object to the parcel pool of the calling thread.
+ *
+ * The object is reset as {@link OH_IPCParcel_Reset} does, and its shared memory threshold is restored to
+ * <b>0</b>, so an object returned by {@link OH_IPCParcel_Obtain} starts with the default. If the pool is full,
+ * the object is destroyed.
+ * The object cannot be used after this function is called.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the <b>OHIPCParcel</b> object to recycle.
+ * @since 21
+ */
+void OH_IPCParcel_Recycle(OHIPCParcel *parcel);
+
+/**
+ * @brief Sets the maximum number of <b>OHIPCParcel</b> objects kept in the parcel pool of the calling thread.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param maxNum Maximum number of pooled objects. The default value is <b>4</b>.
+ * The value range is [0, 64], and the value <b>0</b> disables pooling.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 21
+ */
+int OH_IPCParcel_SetPoolSize(int32_t maxNum);
+
+/**
+ * @brief Clears the data of an <b>OHIPCParcel</b> object and keeps its capacity.
+ *
+ * The read and write positions are set to <b>0</b>, and file descriptors, remote objects and shared memory
+ * mappings held by the object are released. The shared memory threshold set by
+ * {@link OH_IPCParcel_SetSharedMemoryThreshold} is kept.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 21
+ */
+int OH_IPCParcel_Reset(OHIPCParcel *parcel);
+
+/**
+ * @brief Reserves the capacity of an <b>OHIPCParcel</b> object so that writing up to that size does not reallocate.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param capacity Capacity to reserve, in bytes. It cannot exceed 204,800 bytes.
+ * A value smaller than the current capacity has no effect.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_MEM_ALLOCATOR_ERROR} if memory allocation fails.
+ * @since 21
+ */
+int OH_IPCParcel_ReserveCapacity(OHIPCParcel *parcel, int32_t capacity);
+
 /**
  * @brief Obtains the size of the data contained in an <b>OHIPCParcel</b> object.
  *
@@ -405,6 +555,191 @@ int OH_IPCParcel_WriteBuffer(OHIPCParcel *parcel, const uint8_t *buffer, int32_t
  */
 const uint8_t* OH_IPCParcel_ReadBuffer(const OHIPCParcel *parcel, int32_t len);
 
+/**
+ * @brief Writes multiple memory segments to an <b>OHIPCParcel</b> object in one call.
+ *
+ * The segments are written back to back, in array order, as one buffer of their total length.
+ * Capacity is checked and grown once for the whole write, and the result is read back with
+ * {@link OH_IPCParcel_ReadBuffer} or {@link OH_IPCParcel_ReadBufferVector} of the same total length.
+ * The buffer is encoded exactly as {@link OH_IPCParcel_WriteBuffer} encodes a buffer of that length:
+ * if the total length exceeds the threshold set by {@link OH_IPCParcel_SetSharedMemoryThreshold},
+ * the segments are gathered into one shared memory region written by reference.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param vec Pointer to the array of segments to write. It cannot be NULL.
+ * @param count Number of segments in <b>vec</b>, in the range [1, 1024].
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the data write operation fails,
+ * in which case nothing is written.
+ * @since 21
+ */
+int OH_IPCParcel_WriteBufferVector(OHIPCParcel *parcel, const OH_IPC_ConstIoVec *vec, int32_t count);
+
+/**
+ * @brief Reads data from an <b>OHIPCParcel</b> object into multiple memory segments in one call.
+ *
+ * Each segment is filled in array order, and the read position advances by the total length.
+ * A buffer written by reference through shared memory is copied out of the mapping in the same way.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param vec Pointer to the array of segments to fill. It cannot be NULL.
+ * @param count Number of segments in <b>vec</b>, in the range [1, 1024].
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the total length exceeds the readable length,
+ * in which case nothing is read.
+ * @since 21
+ */
+int OH_IPCParcel_ReadBufferVector(const OHIPCParcel *parcel, const OH_IPC_IoVec *vec, int32_t count);
+
+/**
+ * @brief Obtains a read-only view of data in an <b>OHIPCParcel</b> object without moving the read position.
+ *
+ * Together with {@link OH_IPCParcel_RewindReadPosition}, this allows a fixed-layout message to be
+ * validated and accessed in place before it is consumed.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param len Length of the view, in bytes.
+ * @return Returns the address of the data at the read position if the operation is successful. The address is
+ * valid until <b>parcel</b> is written, destroyed, reset or recycled. If the buffer at the read position was written
+ * by reference through shared memory, see {@link OH_IPCParcel_SetSharedMemoryThreshold}, the address of
+ * the read-only mapping of that region is returned, as {@link OH_IPCParcel_ReadBuffer} does, and <b>len</b>
+ * is checked against the length of the region. \n
+ * Returns NULL if invalid parameters are found or <b>len</b> exceeds the readable length of <b>parcel</b>.
+ * @since 21
+ */
+const uint8_t* OH_IPCParcel_PeekBuffer(const OHIPCParcel *parcel, int32_t len);
+
+/**
+ * @brief Writes a shared memory region to an <b>OHIPCParcel</b> object by reference.
+ *
+ * Only the file descriptor and the length are written, so the content is not copied into the parcel.
+ * The receiver reads the region with {@link OH_IPCParcel_ReadSharedMemory}.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param fd File descriptor of the ashmem or memfd region to write. The descriptor is duplicated,
+ * and the caller keeps the ownership of <b>fd</b>.
+ * @param len Length of the data in the region, which cannot exceed the size of the region.
+ * @param seal Whether to seal the region against writing and resizing before it is sent.
+ * Sealing requires a memfd region created with <b>MFD_ALLOW_SEALING</b>.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the data write operation or sealing fails.
+ * @since 21
+ */
+int OH_IPCParcel_WriteSharedMemory(OHIPCParcel *parcel, int32_t fd, int32_t len, bool seal);
+
+/**
+ * @brief Reads a shared memory region from an <b>OHIPCParcel</b> object.
+ *
+ * The region is mapped read-only, and the mapping stays valid until <b>parcel</b> is destroyed, reset or recycled.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param data Pointer to the address of the read-only mapping. It cannot be NULL.
+ * @param len Pointer to the length of the data in the region. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the read or mapping operation fails.
+ * @since 21
+ */
+int OH_IPCParcel_ReadSharedMemory(const OHIPCParcel *parcel, const uint8_t **data, int32_t *len);
+
+/**
+ * @brief Sets the length above which {@link OH_IPCParcel_WriteBuffer} transfers data through shared memory.
+ *
+ * When the length of a buffer exceeds the threshold, it is copied once into a sealed memfd region
+ * that is written by reference, and {@link OH_IPCParcel_ReadBuffer} on the receiver returns
+ * the read-only mapping of that region instead of a copy. The mapping stays valid until the receiving parcel
+ * is destroyed, reset or recycled. The reference is recorded as a file descriptor
+ * object of the parcel, so the receiver tells the two encodings apart without knowing the threshold.
+ * The threshold does not apply to {@link OH_IPCParcel_WriteByCodec}, which always writes inline.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param threshold Length threshold, in bytes. The value <b>0</b> disables the switch, which is the default.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 21
+ */
+int OH_IPCParcel_SetSharedMemoryThreshold(OHIPCParcel *parcel, int32_t threshold);
+
+/**
+ * @brief Creates an <b>OHIPCCodec</b> object from the field list of a fixed C struct.
+ *
+ * The layout is computed once here: the encoded size of a message is fixed, and adjacent fields whose
+ * in-memory layout equals their encoding are merged into a single block copy. Byte array fields are always
+ * copied inline, whatever shared memory threshold is set on the parcel, so that the size stays fixed.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param fields Pointer to the array of fields, in encoding order. It cannot be NULL.
+ * @param count Number of fields, in the range [1, 256].
+ * @param structSize Size of the struct, as given by <b>sizeof</b>. Every field must lie within it.
+ * @return Returns the pointer to the <b>OHIPCCodec</b> object created if the operation is successful;
+ * returns NULL otherwise.
+ * @since 21
+ */
+OHIPCCodec* OH_IPCCodec_Create(const OH_IPC_CodecField *fields, int32_t count, uint32_t structSize);
+
+/**
+ * @brief Destroys an <b>OHIPCCodec</b> object.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param codec Pointer to the <b>OHIPCCodec</b> object to destroy.
+ * @since 21
+ */
+void OH_IPCCodec_Destroy(OHIPCCodec *codec);
+
+/**
+ * @brief Obtains the encoded size of a message described by an <b>OHIPCCodec</b> object.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param codec Pointer to the <b>OHIPCCodec</b> object. It cannot be NULL.
+ * @return Returns the encoded size, in bytes, if the operation is successful. \n
+ * Returns <b>-1</b> if invalid parameters are found.
+ * @since 21
+ */
+int OH_IPCCodec_GetEncodedSize(const OHIPCCodec *codec);
+
+/**
+ * @brief Writes a struct to an <b>OHIPCParcel</b> object using an <b>OHIPCCodec</b> object.
+ *
+ * The capacity is checked once for the whole message.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param codec Pointer to the <b>OHIPCCodec</b> object. It cannot be NULL.
+ * @param object Pointer to the struct to write. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_WRITE_ERROR} if the data write operation fails,
+ * in which case nothing is written.
+ * @since 21
+ */
+int OH_IPCParcel_WriteByCodec(OHIPCParcel *parcel, const OHIPCCodec *codec, const void *object);
+
+/**
+ * @brief Reads a struct from an <b>OHIPCParcel</b> object using an <b>OHIPCCodec</b> object.
+ *
+ * The readable length is checked once for the whole message.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param parcel Pointer to the target <b>OHIPCParcel</b> object. It cannot be NULL.
+ * @param codec Pointer to the <b>OHIPCCodec</b> object. It cannot be NULL.
+ * @param object Pointer to the struct to fill in. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_PARCEL_READ_ERROR} if the encoded size exceeds the readable length,
+ * in which case nothing is read.
+ * @since 21
+ */
+int OH_IPCParcel_ReadByCodec(const OHIPCParcel *parcel, const OHIPCCodec *codec, void *object);
+
 /**
  * @brief Writes an <b>OHIPCRemoteStub</b> object to an <b>OHIPCParcel</b> object.
  *
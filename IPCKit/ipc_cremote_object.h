@@ -29,6 +29,8 @@
  *
  * @brief Defines C interfaces for creating and destroying a remote object, transferring data,
  * and observing the dead status of a remote object.
+ * The asynchronous request interfaces deliver replies on an ffrt queue, so their users also
+ * depend on <b>ffrt/queue.h</b> and libffrt.so.
  *
  * @library libipc_capi.so
  * @kit IPCKit
@@ -39,8 +41,10 @@
 #ifndef CAPI_INCLUDE_IPC_CREMOTE_OBJECT_H
 #define CAPI_INCLUDE_IPC_CREMOTE_OBJECT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include <ffrt/queue.h>
 #include "ipc_cparcel.h"
 
 #ifdef __cplusplus
@@ -171,6 +175,95 @@ typedef struct {
 int OH_IPCRemoteProxy_SendRequest(const OHIPCRemoteProxy *proxy, uint32_t code, const OHIPCParcel *data,
     OHIPCParcel *reply, const OH_IPC_MessageOption *option);
 
+/**
+ * @brief Called when the reply of an asynchronous request arrives or the request ends without a reply.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param requestId ID of the request, which is returned by {@link OH_IPCRemoteProxy_SendRequestAsync}.
+ * @param result {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the reply arrived. \n
+ * {@link OH_IPC_ErrorCode#OH_IPC_REQUEST_TIMEOUT} if the request timed out. \n
+ * {@link OH_IPC_ErrorCode#OH_IPC_REQUEST_CANCELED} if the request was canceled. \n
+ * {@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT} if the <b>OHIPCRemoteStub</b> object died. \n
+ * The error code returned by the stub in other cases.
+ * @param reply Pointer to the response data object, which is NULL if <b>result</b> is not
+ * {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS}. It is destroyed after the callback returns and cannot be released
+ * in the function.
+ * @param userData Pointer to the user data. It can be NULL.
+ * @since 21
+ */
+typedef void (*OH_OnRemoteReplyCallback)(uint64_t requestId, int result, const OHIPCParcel *reply, void *userData);
+
+/**
+ * @brief Defines the options of an asynchronous request that expects a reply.
+ *
+ * @since 21
+ */
+#pragma pack(4)
+typedef struct {
+    /** Timeout of the request, in milliseconds. The value <b>0</b> means no timeout. */
+    uint32_t timeout;
+    /** Queue on which the callback is executed. If it is NULL, callbacks of a proxy run in submission order
+     *  on an internal serial queue of the proxy. */
+    ffrt_queue_t queue;
+    /** Reserved parameter, which must be NULL. */
+    void* reserved;
+} OH_IPC_AsyncRequestOption;
+#pragma pack()
+
+/**
+ * @brief Sends an IPC message without blocking and delivers the reply to a callback.
+ *
+ * Unlike {@link OH_IPC_RequestMode#OH_IPC_REQUEST_MODE_ASYNC}, the stub reply is kept and passed to
+ * <b>callback</b>. Multiple requests of one proxy can be in flight at the same time.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy Pointer to the <b>OHIPCRemoteProxy</b> object. It cannot be NULL.
+ * @param code Custom IPC command word, in the range [0x01, 0x00ffffff].
+ * @param data Pointer to the request data object. It cannot be NULL, and can be destroyed once this function returns.
+ * @param option Pointer to the request options. It can be NULL, which indicates no timeout and the default queue.
+ * @param callback Callback used to receive the reply. It cannot be NULL.
+ * @param userData Pointer to the user data passed to <b>callback</b>. It can be NULL.
+ * @param requestId Pointer to the ID of the request, used by {@link OH_IPCRemoteProxy_CancelRequest}. It can be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the request is sent;
+ * the callback is then invoked exactly once. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_DEAD_REMOTE_OBJECT} if the <b>OHIPCRemoteStub</b> object is dead. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_TOO_MANY_REQUESTS} if the in-flight limit of <b>proxy</b> is reached. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR} in other cases.
+ * @since 21
+ */
+int OH_IPCRemoteProxy_SendRequestAsync(const OHIPCRemoteProxy *proxy, uint32_t code, const OHIPCParcel *data,
+    const OH_IPC_AsyncRequestOption *option, OH_OnRemoteReplyCallback callback, void *userData, uint64_t *requestId);
+
+/**
+ * @brief Cancels an asynchronous request sent by {@link OH_IPCRemoteProxy_SendRequestAsync}.
+ *
+ * The stub may still process the request, but its reply is discarded and the callback is invoked with
+ * {@link OH_IPC_ErrorCode#OH_IPC_REQUEST_CANCELED}.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy Pointer to the <b>OHIPCRemoteProxy</b> object. It cannot be NULL.
+ * @param requestId ID of the request to cancel.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the request is canceled. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found
+ * or the request has already completed.
+ * @since 21
+ */
+int OH_IPCRemoteProxy_CancelRequest(const OHIPCRemoteProxy *proxy, uint64_t requestId);
+
+/**
+ * @brief Sets the maximum number of asynchronous requests of a proxy that can be in flight at the same time.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param proxy Pointer to the <b>OHIPCRemoteProxy</b> object. It cannot be NULL.
+ * @param maxRequests Maximum number of in-flight requests. The default value is <b>64</b>.
+ * The value range is [1, 1024].
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if invalid parameters are found.
+ * @since 21
+ */
+int OH_IPCRemoteProxy_SetMaxInflightRequests(OHIPCRemoteProxy *proxy, int32_t maxRequests);
+
 /**
  * @brief Obtains the interface descriptor from the stub.
  *
@@ -39,6 +39,7 @@
 #ifndef CAPI_INCLUDE_IPC_CSKELETON_H
 #define CAPI_INCLUDE_IPC_CSKELETON_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "ipc_cparcel.h"
@@ -133,6 +134,73 @@ int OH_IPCSkeleton_IsLocalCalling(void);
  */
 int OH_IPCSkeleton_SetMaxWorkThreadNum(const int maxThreadNum);
 
+/**
+ * @brief Defines the configuration of the adaptive worker thread pool.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Minimum number of worker threads, in the range [1, 32]. */
+    int32_t minThreadNum;
+    /** Maximum number of worker threads, in the range [minThreadNum, 32]. */
+    int32_t maxThreadNum;
+    /** A thread is added when requests wait longer than this before being picked up, in microseconds. */
+    uint32_t targetQueueDelayUs;
+    /** A thread above <b>minThreadNum</b> exits after being idle for this long, in milliseconds. */
+    uint32_t idleTimeoutMs;
+    /** QoS level of the worker threads, as defined by QoS_Level in qos.h, or <b>-1</b> to keep the default. */
+    int32_t qos;
+    /** Whether stub callbacks are dispatched to ffrt workers of <b>qos</b>, so that worker threads only
+     *  receive requests. */
+    bool dispatchToFfrt;
+} OH_IPC_WorkThreadPoolConfig;
+
+/**
+ * @brief Defines the statistics of the worker thread pool.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Current number of worker threads. */
+    int32_t threadNum;
+    /** Number of worker threads handling a request. */
+    int32_t busyThreadNum;
+    /** Largest number of worker threads since the pool was configured. */
+    int32_t peakThreadNum;
+    /** Average time requests waited before being picked up over the last second, in microseconds. */
+    uint32_t avgQueueDelayUs;
+    /** Number of requests waiting to be picked up. */
+    uint32_t pendingRequestNum;
+} OH_IPC_WorkThreadPoolStat;
+
+/**
+ * @brief Switches the worker thread pool to adaptive mode.
+ *
+ * The pool grows when the observed queueing delay exceeds <b>targetQueueDelayUs</b> and shrinks when
+ * threads stay idle, within [<b>minThreadNum</b>, <b>maxThreadNum</b>].
+ * It replaces the fixed limit set by {@link OH_IPCSkeleton_SetMaxWorkThreadNum}, and calling
+ * {@link OH_IPCSkeleton_SetMaxWorkThreadNum} afterwards switches the pool back to a fixed limit.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param config Pointer to the pool configuration. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if incorrect parameters are found. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_INNER_ERROR} in other cases.
+ * @since 21
+ */
+int OH_IPCSkeleton_SetAdaptiveWorkThreadPool(const OH_IPC_WorkThreadPoolConfig *config);
+
+/**
+ * @brief Obtains the statistics of the worker thread pool.
+ *
+ * @syscap SystemCapability.Communication.IPC.Core
+ * @param stat Pointer to the statistics to be filled in. It cannot be NULL.
+ * @return Returns {@link OH_IPC_ErrorCode#OH_IPC_SUCCESS} if the operation is successful. \n
+ * Returns {@link OH_IPC_ErrorCode#OH_IPC_CHECK_PARAM_ERROR} if incorrect parameters are found.
+ * @since 21
+ */
+int OH_IPCSkeleton_GetWorkThreadPoolStat(OH_IPC_WorkThreadPoolStat *stat);
+
 /**
  * @brief Resets the caller identity credential (including the token ID, UID, and PID) to that of this process and
  * returns the caller credential information.
@@ -63,6 +63,21 @@ typedef enum {
     OH_IPC_INVALID_USER_ERROR_CODE = OH_IPC_ERROR_CODE_BASE + 6,
     /** @error IPC internal error. */
     OH_IPC_INNER_ERROR = OH_IPC_ERROR_CODE_BASE + 7,
+    /**
+     * @error The request timed out before the reply arrived.
+     * @since 21
+     */
+    OH_IPC_REQUEST_TIMEOUT = OH_IPC_ERROR_CODE_BASE + 8,
+    /**
+     * @error The request was canceled before the reply arrived.
+     * @since 21
+     */
+    OH_IPC_REQUEST_CANCELED = OH_IPC_ERROR_CODE_BASE + 9,
+    /**
+     * @error The number of in-flight requests reached the limit.
+     * @since 21
+     */
+    OH_IPC_TOO_MANY_REQUESTS = OH_IPC_ERROR_CODE_BASE + 10,
     /** @error Maximum error code. */
     OH_IPC_ERROR_CODE_MAX = OH_IPC_ERROR_CODE_BASE + 1000,
     /** @error Minimum value for a custom error code. */
@@ -27,6 +27,8 @@
  * @file ipc_kit.h
  *
  * @brief Provides an entry to the IPC header files for you to reference.
+ * <b>ipc_cremote_object.h</b> includes <b>ffrt/queue.h</b> for the asynchronous request interfaces,
+ * so the ffrt headers must be available and libffrt.so linked when they are used.
  *
  * @library libipc_capi.so
  * @kit IPCKit
@@ -41,6 +43,7 @@
 #include "ipc_cparcel.h"
 #include "ipc_cremote_object.h"
 #include "ipc_cskeleton.h"
+#include "ipc_cmetrics.h"
 
 /** @} */
 #endif
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup memory
+ * @{
+ *
+ * @brief provides memory management capabilities
+ *
+ * provides features include operations such as memory alloction, memory free, and so on
+ *
+ * @since 10
+ * @version 1.0
+ */
+
+/**
+ * @file purgeable_cache.h
+ *
+ * @brief provides a keyed LRU cache of purgeable memory objects.
+ *
+ * provides features include create, get, get or create, end read, remove, trim and statistics.
+ * Every entry is a PurgMem obj, so the OS may reclaim entries under memory pressure and the
+ * cache rebuilds them on the next access. The total content size of entries is bounded by a
+ * byte budget, and least recently used entries are destroyed first when it is exceeded.
+ * when using, it is necessary to link libpurgeable_memory_ndk.z.so
+ *
+ * @library libpurgeablemem.z.so
+ * @syscap SystemCapability.Kernel.Memory
+ * @kit KernelEnhanceKit
+ * @since 21
+ * @version 1.0
+ */
+
+#ifndef OHOS_UTILS_MEMORY_LIBPURGEABLEMEM_C_INCLUDE_PURGEABLE_CACHE_H
+#define OHOS_UTILS_MEMORY_LIBPURGEABLEMEM_C_INCLUDE_PURGEABLE_CACHE_H
+
+#include <stdbool.h> /* bool */
+#include <stddef.h> /* size_t */
+#include <stdint.h> /* uint64_t */
+#include "purgeable_memory.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* End of #ifdef __cplusplus */
+
+/**
+ * @brief Purgeable cache struct
+ *
+ * @since 21
+ * @version 1.0
+ */
+typedef struct PurgCache OH_PurgeableCache;
+
+/**
+ * @brief Purgeable cache statistics
+ *
+ * @since 21
+ * @version 1.0
+ */
+typedef struct {
+    /** Number of lookups that found a present entry. */
+    uint64_t hits;
+    /** Number of lookups that found no entry. */
+    uint64_t misses;
+    /** Number of entries rebuilt because the OS purged their content. */
+    uint64_t rebuilds;
+    /** Number of rebuilds that failed, after which the entry was removed. */
+    uint64_t rebuildFailures;
+    /** Number of entries destroyed to stay within the budget. */
+    uint64_t evictions;
+    /** Number of entries currently in the cache. */
+    size_t count;
+    /** Total content size of the entries currently in the cache. */
+    size_t size;
+} OH_PurgeableCache_Stat;
+
+/**
+ * @brief: create a purgeable cache.
+ *
+ *
+ * @param budget Maximum total content size of the entries, in bytes.
+ * @return: a purgeable cache, or NULL if @budget is 0 or out of memory.
+ *
+ * @since 21
+ * @version 1.0
+ */
+OH_PurgeableCache *OH_PurgeableCache_Create(size_t budget);
+
+/**
+ * @brief: destroy a purgeable cache and all of its entries.
+ *
+ *
+ * @param cache A purgeable cache to be destroyed.
+ * @return: true is success, while false is fail. return true if @cache is NULL.
+ * return false if any entry is still being read.
+ *
+ * @since 21
+ * @version 1.0
+ */
+bool OH_PurgeableCache_Destroy(OH_PurgeableCache *cache);
+
+/**
+ * @brief: look up an entry and begin read it.
+ *
+ *
+ * @param cache A purgeable cache.
+ * @param key Start address of the key.
+ * @param keyLen Size of the key, in bytes.
+ * @return: the PurgMem obj of the entry, on which OH_PurgeableMemory_BeginRead() has succeeded.
+ *          If the content was purged, it is rebuilt by the @func passed to OH_PurgeableCache_GetOrCreate
+ *          when the entry was created.
+ *          Return NULL if there is no such entry or the rebuild failed.
+ * OS cannot reclaim the content of the returned obj until OH_PurgeableCache_EndRead() is called,
+ * and the entry is not evicted meanwhile.
+ *
+ * @since 21
+ * @version 1.0
+ */
+OH_PurgeableMemory *OH_PurgeableCache_Get(OH_PurgeableCache *cache, const void *key, size_t keyLen);
+
+/**
+ * @brief: look up an entry, create it if absent, and begin read it.
+ *
+ *
+ * @param cache A purgeable cache.
+ * @param key Start address of the key.
+ * @param keyLen Size of the key, in bytes.
+ * @param size Data size of the content, used when the entry is created.
+ * @param func Function pointer, it is used to build the content when the entry is created or purged.
+ * @param funcPara Parameters used by @func.
+ * @return: the PurgMem obj of the entry, on which OH_PurgeableMemory_BeginRead() has succeeded.
+ *          Return NULL if the entry cannot be created or built, or @size exceeds the budget.
+ * Least recently used entries that are not being read are destroyed to make room.
+ *
+ * @since 21
+ * @version 1.0
+ */
+OH_PurgeableMemory *OH_PurgeableCache_GetOrCreate(OH_PurgeableCache *cache, const void *key, size_t keyLen,
+    size_t size, OH_PurgeableMemory_ModifyFunc func, void *funcPara);
+
+/**
+ * @brief: end read an entry obtained from a purgeable cache.
+ *
+ *
+ * @param cache A purgeable cache.
+ * @param purgObj A PurgMem obj returned by OH_PurgeableCache_Get() or OH_PurgeableCache_GetOrCreate().
+ * OS may reclaim the content of @purgObj at a later time when this function returns.
+ *
+ * @since 21
+ * @version 1.0
+ */
+void OH_PurgeableCache_EndRead(OH_PurgeableCache *cache, OH_PurgeableMemory *purgObj);
+
+/**
+ * @brief: remove an entry from a purgeable cache.
+ *
+ *
+ * @param cache A purgeable cache.
+ * @param key Start address of the key.
+ * @param keyLen Size of the key, in bytes.
+ * @return: true if the entry is removed, while false if there is no such entry.
+ * An entry being read is destroyed when its last OH_PurgeableCache_EndRead() is called.
+ *
+ * @since 21
+ * @version 1.0
+ */
+bool OH_PurgeableCache_Remove(OH_PurgeableCache *cache, const void *key, size_t keyLen);
+
+/**
+ * @brief: destroy least recently used entries until the total content size is within a target.
+ *
+ *
+ * @param cache A purgeable cache.
+ * @param targetSize Target total content size, in bytes. 0 destroys all entries not being read.
+ * @return: total content size after trimming.
+ *
+ * @since 21
+ * @version 1.0
+ */
+size_t OH_PurgeableCache_Trim(OH_PurgeableCache *cache, size_t targetSize);
+
+/**
+ * @brief: get statistics of a purgeable cache.
+ *
+ *
+ * @param cache A purgeable cache.
+ * @param stat Statistics to be filled in.
+ * @return: true is success, while false is fail. return false if @cache or @stat is NULL.
+ *
+ * @since 21
+ * @version 1.0
+ */
+bool OH_PurgeableCache_GetStat(OH_PurgeableCache *cache, OH_PurgeableCache_Stat *stat);
+
+#ifdef __cplusplus
+}
+#endif /* End of #ifdef __cplusplus */
+#endif /* OHOS_UTILS_MEMORY_LIBPURGEABLEMEM_C_INCLUDE_PURGEABLE_CACHE_H */
+/** @} */
@@ -39,6 +39,7 @@
 #ifndef NDK_INCLUDE_NATIVE_BUFFER_H_
 #define NDK_INCLUDE_NATIVE_BUFFER_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <native_window/external_window.h>
 #include <native_buffer/buffer_common.h>
@@ -498,6 +499,141 @@ int32_t OH_NativeBuffer_SetMetadataValue(OH_NativeBuffer *buffer, OH_NativeBuffe
 int32_t OH_NativeBuffer_GetMetadataValue(OH_NativeBuffer *buffer, OH_NativeBuffer_MetadataKey metadataKey,
     int32_t *size, uint8_t **metadata);
 
+/**
+ * @brief Defines the buffer pool, which caches released <b>OH_NativeBuffer</b> instances for reuse, keyed by
+ * the width, height, format and usage of <b>OH_NativeBuffer_Config</b>. The stride is an output of
+ * allocation and is ignored, so a config returned by <b>OH_NativeBuffer_GetConfig</b> matches too.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @since 21
+ * @version 1.0
+ */
+typedef struct OH_NativeBufferPool OH_NativeBufferPool;
+
+/**
+ * @brief <b>OH_NativeBufferPool</b> config. \n
+ * The counts apply to each pool key, that is each width, height, format and usage, separately.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @since 21
+ * @version 1.0
+ */
+typedef struct {
+    uint32_t minCount;       ///< Number of idle buffers kept when the pool is trimmed
+    uint32_t maxCount;       ///< Max number of buffers allocated, 0 means no limit
+} OH_NativeBufferPool_Config;
+
+/**
+ * @brief Statistics of an <b>OH_NativeBufferPool</b>. \n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @since 21
+ * @version 1.0
+ */
+typedef struct {
+    uint64_t allocCount;     ///< Number of buffers newly allocated
+    uint64_t reuseCount;     ///< Number of buffers reused from idle buffers
+    uint64_t freeCount;      ///< Number of idle buffers freed by trimming
+    uint32_t idleCount;      ///< Number of idle buffers in the pool
+    uint32_t inUseCount;     ///< Number of buffers acquired and not yet released
+    uint64_t idleBytes;      ///< Memory held by idle buffers in bytes
+} OH_NativeBufferPool_Stat;
+
+/**
+ * @brief Create a <b>OH_NativeBufferPool</b>. \n
+ * Idle buffers beyond minCount are also trimmed when the system reports memory pressure.\n
+ * This interface needs to be used in conjunction with <b>OH_NativeBuffer_DestroyPool</b>,
+ * otherwise memory leaks will occur.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param config Indicates the pointer to a <b>OH_NativeBufferPool_Config</b> instance.
+ * @return Returns the pointer to the <b>OH_NativeBufferPool</b> instance created if the operation is successful, \n
+ * returns <b>NULL</b> if config is NULL or minCount is greater than a non-zero maxCount.
+ * @since 21
+ * @version 1.0
+ */
+OH_NativeBufferPool* OH_NativeBuffer_CreatePool(const OH_NativeBufferPool_Config* config);
+
+/**
+ * @brief Destroy a <b>OH_NativeBufferPool</b>. \n
+ * Idle buffers are freed at once, buffers in use are freed when their reference count reaches 0.\n
+ * This interface is a thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBufferPool</b> instance.
+ * @since 21
+ * @version 1.0
+ */
+void OH_NativeBuffer_DestroyPool(OH_NativeBufferPool *pool);
+
+/**
+ * @brief Acquire a <b>OH_NativeBuffer</b> that matches the passed config from a <b>OH_NativeBufferPool</b>. \n
+ * An idle buffer with the same width, height, format and usage is reused if there is one,
+ * otherwise a new buffer is allocated. The stride of config is ignored.\n
+ * When the reference count of the buffer reaches 0 by <b>OH_NativeBuffer_Unreference</b>,
+ * the buffer is returned to the pool instead of being destroyed. On return its color space is reset to the
+ * default and the metadata set by <b>OH_NativeBuffer_SetMetadataValue</b> is cleared, so an acquired buffer
+ * never carries the color space or HDR metadata of a previous use.\n
+ * This interface is a thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBufferPool</b> instance.
+ * @param config Indicates the pointer to a <b>OH_NativeBuffer_Config</b> instance.
+ * @param buffer Indicates the double pointer to a <b>OH_NativeBuffer</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool, config or buffer is NULL.
+ *     {@link NATIVE_ERROR_NO_BUFFER} 40601000 - maxCount buffers of the config are in use.
+ *     {@link NATIVE_ERROR_MEM_OPERATION_ERROR} 30001000 - Failed to allocate a new buffer.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_AcquireFromPool(OH_NativeBufferPool *pool, const OH_NativeBuffer_Config *config,
+    OH_NativeBuffer **buffer);
+
+/**
+ * @brief Allocate idle buffers of the passed config until the pool holds minCount of them. \n
+ * It can be called ahead of a resolution change so that the following acquires do not allocate.\n
+ * This interface is a thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBufferPool</b> instance.
+ * @param config Indicates the pointer to a <b>OH_NativeBuffer_Config</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool or config is NULL.
+ *     {@link NATIVE_ERROR_MEM_OPERATION_ERROR} 30001000 - Failed to allocate a new buffer.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_PreparePool(OH_NativeBufferPool *pool, const OH_NativeBuffer_Config *config);
+
+/**
+ * @brief Free idle buffers of a <b>OH_NativeBufferPool</b>. \n
+ * This interface is a thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBufferPool</b> instance.
+ * @param keepMinCount Indicates whether to keep minCount idle buffers of each config, false to free all of them.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool is NULL.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_TrimPool(OH_NativeBufferPool *pool, bool keepMinCount);
+
+/**
+ * @brief Get the statistics of a <b>OH_NativeBufferPool</b>. \n
+ * This interface is a thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeBuffer
+ * @param pool Indicates the pointer to a <b>OH_NativeBufferPool</b> instance.
+ * @param stat Indicates the pointer to a <b>OH_NativeBufferPool_Stat</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - pool or stat is NULL.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeBuffer_GetPoolStat(OH_NativeBufferPool *pool, OH_NativeBufferPool_Stat *stat);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,7 @@
 #define NDK_INCLUDE_NATIVE_FENCE_H_
 
 #include <stdint.h>
+#include <ffrt/loop.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -98,6 +99,109 @@ bool OH_NativeFence_WaitForever(int fenceFd);
  * @version 1.0
  */
 void OH_NativeFence_Close(int fenceFd);
+
+/**
+ * @brief Indicates the timeout value that waits forever, used by {@link OH_NativeFence_WaitAll},
+ * {@link OH_NativeFence_WaitAny} and {@link OH_NativeFence_WaitAsync}.
+ *
+ * @since 21
+ * @version 1.0
+ */
+#define OH_NATIVE_FENCE_WAIT_FOREVER UINT32_MAX
+
+/**
+ * @brief Waits until all fences in the array are signaled. The maximum waiting time for all fences together
+ * is determined by the timeout parameter.
+ * The incoming fenceFds need to be closed by the user themselves.
+ *
+ * @param fenceFds Indicates the array of file descriptor handles. A negative integer means no fence,
+ * which is treated as already signaled.
+ * @param count Indicates the number of elements in fenceFds.
+ * @param timeout Indicates the timeout duration.
+ * The unit is milliseconds, 0 represents checking the fences once and returning immediately,
+ * {@link OH_NATIVE_FENCE_WAIT_FOREVER} represents waiting forever.
+ * @return Returns true if all fences signaled, including when all fenceFds are negative integers.
+ *         Returns false in the following cases:
+ *         1.fenceFds is NULL or count is 0.
+ *         2.not all fences signaled within the specified timeout period.
+ *         3.the underlying poll interface call failed.
+ * @since 21
+ * @version 1.0
+ */
+bool OH_NativeFence_WaitAll(const int *fenceFds, uint32_t count, uint32_t timeout);
+
+/**
+ * @brief Waits until any fence in the array is signaled. The maximum waiting time is determined by
+ * the timeout parameter.
+ * The incoming fenceFds need to be closed by the user themselves.
+ *
+ * @param fenceFds Indicates the array of file descriptor handles. A negative integer means no fence,
+ * which is treated as already signaled.
+ * @param count Indicates the number of elements in fenceFds.
+ * @param timeout Indicates the timeout duration.
+ * The unit is milliseconds, 0 represents checking the fences once and returning immediately,
+ * {@link OH_NATIVE_FENCE_WAIT_FOREVER} represents waiting forever.
+ * @param index Indicates the pointer used to save the index of the first signaled fence, it can be NULL.
+ * If fenceFds contains a negative integer, the function returns at once with the index of the first one.
+ * @return Returns true if any fence signaled, including when fenceFds contains a negative integer.
+ *         Returns false in the following cases:
+ *         1.fenceFds is NULL or count is 0.
+ *         2.no fence signaled within the specified timeout period.
+ *         3.the underlying poll interface call failed.
+ * @since 21
+ * @version 1.0
+ */
+bool OH_NativeFence_WaitAny(const int *fenceFds, uint32_t count, uint32_t timeout, uint32_t *index);
+
+/**
+ * @brief Merges fences into one fence which is signaled when all of them are signaled.
+ * The incoming fenceFds need to be closed by the user themselves.
+ *
+ * @param fenceFds Indicates the array of file descriptor handles. Negative integers are skipped.
+ * @param count Indicates the number of elements in fenceFds.
+ * @return Returns the file descriptor handle of the merged fence, which needs to be closed by
+ *         {@link OH_NativeFence_Close}.
+ *         Returns -1 if fenceFds is NULL, count is 0, all fenceFds are negative integers or the merge failed.
+ * @since 21
+ * @version 1.0
+ */
+int OH_NativeFence_Merge(const int *fenceFds, uint32_t count);
+
+/**
+ * @brief Defines the callback of {@link OH_NativeFence_WaitAsync}.
+ *
+ * @param userData Indicates the user data passed to {@link OH_NativeFence_WaitAsync}.
+ * @param signaled Indicates whether all fences signaled, false if the timeout expired.
+ * @since 21
+ * @version 1.0
+ */
+typedef void (*OH_NativeFence_WaitCallback)(void *userData, bool signaled);
+
+/**
+ * @brief Registers fences on an ffrt loop and returns at once. The callback is invoked once in the loop
+ * when all fences are signaled or the timeout expires. If all fenceFds are negative integers, there is nothing
+ * to wait for and the callback is invoked in the loop with signaled set to true.
+ * The fenceFds are duplicated, so the incoming fenceFds can be closed by the user after return.
+ *
+ * @param loop Indicates the ffrt loop created by ffrt_loop_create.
+ * @param fenceFds Indicates the array of file descriptor handles. A negative integer means no fence,
+ * which is treated as already signaled.
+ * @param count Indicates the number of elements in fenceFds.
+ * @param timeout Indicates the timeout duration.
+ * The unit is milliseconds, 0 represents checking the fences once in the loop,
+ * {@link OH_NATIVE_FENCE_WAIT_FOREVER} represents waiting forever.
+ * @param callback Indicates the callback to be invoked.
+ * @param userData Indicates the user data passed to the callback.
+ * @return Returns true if the fences are registered.
+ *         Returns false in the following cases:
+ *         1.loop, fenceFds or callback is NULL, or count is 0.
+ *         2.failed to duplicate the file descriptor.
+ *         3.failed to register the file descriptor on the loop.
+ * @since 21
+ * @version 1.0
+ */
+bool OH_NativeFence_WaitAsync(ffrt_loop_t loop, const int *fenceFds, uint32_t count, uint32_t timeout,
+    OH_NativeFence_WaitCallback callback, void *userData);
 #ifdef __cplusplus
 }
 #endif
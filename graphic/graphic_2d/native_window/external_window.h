@@ -273,6 +273,16 @@ typedef enum NativeWindowOperation {
      * @since 13
      */
     SET_DESIRED_PRESENT_TIMESTAMP = 24,
+    /**
+     * set the number of buffers in the buffer queue, 2 for double, 3 for triple and 4 for quad buffering.\n
+     * A larger queue lets the producer request a buffer without waiting for the consumer at the cost of
+     * one more frame of memory.\n
+     * The value can be obtained by <b>GET_BUFFERQUEUE_SIZE</b>.\n
+     * Variable parameter in function is
+     * [in] int32_t queueSize. the value range is 2 to 4.
+     * @since 21
+     */
+    SET_BUFFERQUEUE_SIZE = 25,
 } NativeWindowOperation;
 
 /**
@@ -894,6 +904,81 @@ int32_t OH_NativeWindow_GetMetadataValue(OHNativeWindow *window, OH_NativeBuffer
  * @version 1.0
  */
 int32_t OH_NativeWindow_CleanCache(OHNativeWindow *window);
+
+/**
+ * @brief Requests the <b>OHNativeWindowBuffer</b> through a <b>OHNativeWindow</b> instance without blocking.\n
+ * Same as <b>OH_NativeWindow_NativeWindowRequestBuffer</b>, except that it returns at once instead of
+ * waiting for the consumer when no idle buffer is available.\n
+ * When the fenceFd is used up, you need to close it.\n
+ * This interface is a non-thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window Indicates the pointer to a <b>OHNativeWindow</b> instance.
+ * @param buffer Indicates the double pointer to a <b>OHNativeWindowBuffer</b> instance.
+ * @param fenceFd Indicates the pointer to a file descriptor handle.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - window, buffer or fenceFd is NULL.
+ *     {@link NATIVE_ERROR_NO_BUFFER} 40601000 - no idle buffer is available now.
+ *     {@link NATIVE_ERROR_CONSUMER_DISCONNECTED} 41211000 - the consumer is disconnected.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_NativeWindowTryRequestBuffer(OHNativeWindow *window,
+    OHNativeWindowBuffer **buffer, int *fenceFd);
+
+/**
+ * @brief Dequeues the next <b>OHNativeWindowBuffer</b> ahead of time in the background.\n
+ * The next <b>OH_NativeWindow_NativeWindowRequestBuffer</b> or
+ * <b>OH_NativeWindow_NativeWindowTryRequestBuffer</b> returns the prefetched buffer without an ipc call.\n
+ * It is usually called right after <b>OH_NativeWindow_NativeWindowFlushBuffer</b>.
+ * The prefetched buffer is returned to the buffer queue when the window is destroyed or
+ * <b>OH_NativeWindow_CleanCache</b> is called.\n
+ * If <b>SET_BUFFER_GEOMETRY</b>, <b>SET_FORMAT</b>, <b>SET_USAGE</b> or any other operation that changes
+ * the buffer config is set after the prefetch, the prefetched buffer is returned to the buffer queue
+ * and the next request dequeues a new buffer with the new config, so a stale buffer is never returned.\n
+ * This interface is a non-thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window Indicates the pointer to a <b>OHNativeWindow</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success, or a buffer has already been prefetched.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - window is NULL.
+ *     {@link NATIVE_ERROR_CONSUMER_DISCONNECTED} 41211000 - the consumer is disconnected.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_PrefetchBuffer(OHNativeWindow *window);
+
+/**
+ * @brief Indicates the timings of the last cycle of an <b>OHNativeWindowBuffer</b>, in nanoseconds,
+ * generated by std::chrono::steady_clock.
+ * @since 21
+ */
+typedef struct OHNativeWindowBufferTimings {
+    /** the time the producer waited for the buffer in the request */
+    int64_t dequeueWaitTime;
+    /** the timestamp the buffer was flushed to the buffer queue */
+    int64_t queueTimestamp;
+    /** the timestamp the buffer was presented, 0 if it is not presented yet or was dropped */
+    int64_t presentTimestamp;
+} OHNativeWindowBufferTimings;
+
+/**
+ * @brief Get the timings of the last cycle of an <b>OHNativeWindowBuffer</b>.\n
+ * The queue-to-present latency is <b>presentTimestamp</b> minus <b>queueTimestamp</b>.\n
+ * This interface is a non-thread-safe type interface.\n
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeWindow
+ * @param window Indicates the pointer to a <b>OHNativeWindow</b> instance.
+ * @param buffer Indicates the pointer to a <b>OHNativeWindowBuffer</b> instance.
+ * @param timings Indicates the pointer to a <b>OHNativeWindowBufferTimings</b> instance.
+ * @return {@link NATIVE_ERROR_OK} 0 - Success.
+ *     {@link NATIVE_ERROR_INVALID_ARGUMENTS} 40001000 - window, buffer or timings is NULL.
+ *     {@link NATIVE_ERROR_BUFFER_NOT_IN_CACHE} 41210000 - buffer does not belong to the window.
+ * @since 21
+ * @version 1.0
+ */
+int32_t OH_NativeWindow_GetBufferTimings(OHNativeWindow *window, OHNativeWindowBuffer *buffer,
+    OHNativeWindowBufferTimings *timings);
 #ifdef __cplusplus
 }
 #endif
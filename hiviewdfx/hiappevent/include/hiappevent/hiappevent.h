@@ -249,6 +249,78 @@ typedef void (*OH_HiAppEvent_OnTrigger)(int row, int size);
  */
 typedef void (*OH_HiAppEvent_OnTake)(const char* const *events, uint32_t eventLen);
 
+/**
+ * @brief The HiAppEvent_EventBatch structure is a packed binary batch of events delivered to a watcher.
+ *
+ * Events in a batch are grouped by domain and name, and the parameters of each group are stored as typed columns.
+ *
+ * @since 21
+ */
+typedef struct HiAppEvent_EventBatch HiAppEvent_EventBatch;
+
+/**
+ * @brief Enumerates the column types of an event batch.
+ *
+ * @since 21
+ */
+typedef enum {
+    /** bool values. */
+    HIAPPEVENT_COLUMN_BOOL = 0,
+    /** int64_t values, used for all integer parameters. */
+    HIAPPEVENT_COLUMN_INT64 = 1,
+    /** double values, used for all floating-point parameters. */
+    HIAPPEVENT_COLUMN_DOUBLE = 2,
+    /** const char* values. */
+    HIAPPEVENT_COLUMN_STRING = 3,
+    /** const char* values holding the json string of array parameters. */
+    HIAPPEVENT_COLUMN_JSON = 4,
+} HiAppEvent_ColumnType;
+
+/**
+ * @brief The HiAppEvent_BatchGroup structure describes the events of one domain and name in an event batch.
+ *
+ * @since 21
+ */
+typedef struct HiAppEvent_BatchGroup {
+    /* The domain of the events. */
+    const char* domain;
+    /* The name of the events. */
+    const char* name;
+    /* The type of the events. */
+    enum EventType type;
+    /* The number of events in the group. */
+    uint32_t rowCount;
+    /* The time of each event in milliseconds since the epoch, rowCount elements. */
+    const int64_t* times;
+    /* The number of parameter columns in the group. */
+    uint32_t columnCount;
+} HiAppEvent_BatchGroup;
+
+/**
+ * @brief The HiAppEvent_BatchColumn structure holds the values of one parameter of the events in a group.
+ *
+ * @since 21
+ */
+typedef struct HiAppEvent_BatchColumn {
+    /* The name of the parameter. */
+    const char* name;
+    /* The type of the values. */
+    HiAppEvent_ColumnType type;
+    /* The array of rowCount values, whose element type is given by type. */
+    const void* values;
+    /* Bitmap in which bit (row % 8) of byte (row / 8) is set if the event of that row has the parameter;
+     * NULL if all events have it. */
+    const uint8_t* present;
+} HiAppEvent_BatchColumn;
+
+/**
+ * @brief Called when a watcher receives an event batch.
+ *
+ * @param batch The event batch, which is valid only in the function.
+ * @since 21
+ */
+typedef void (*OH_HiAppEvent_OnReceiveBatch)(const HiAppEvent_EventBatch* batch);
+
 /**
  * @brief Create a pointer to the ParamList.
  *
@@ -491,11 +563,40 @@ ParamList OH_HiAppEvent_AddStringArrayParam(ParamList list, const char* name, co
  *         {@code 5} Invalid number of event parameters.
  *         {@code 6} Invalid array length of the event parameter.
  *         {@code 8} Duplicate parameter.
+ *         {@code -100} The event is dropped because the buffer quota is used up in "async" write mode,
+ *         see {@link ASYNC_BUFFER_SIZE}. The event is also counted by {@link OH_HiAppEvent_GetDroppedEventCount}.
+ *         In "async" write mode, see {@link WRITE_MODE}, the verification is still done before returning, so all the
+ *         codes above are reported the same way as in "sync" mode, and a return value of 0 or a positive integer
+ *         means the event is buffered rather than written. A failure of the background writer to persist
+ *         a buffered event is not reported to the caller, and is only visible through
+ *         {@link OH_HiAppEvent_GetDroppedEventCount}.
  * @since 8
  * @version 1.0
  */
 int OH_HiAppEvent_Write(const char* domain, const char* name, enum EventType type, const ParamList list);
 
+/**
+ * @brief Persists all events buffered in "async" write mode before returning.
+ *
+ * Call it before the application exits. In "sync" write mode, it returns at once.
+ *
+ * @param timeoutMs The maximum time to wait, in milliseconds. The value 0 means waiting until done.
+ * @return flush result.
+ *         {@link HIAPPEVENT_SUCCESS} The operation is successful.
+ *         {@link HIAPPEVENT_OPERATE_FAILED} The events were not all persisted within the timeout.
+ * @since 21
+ */
+int OH_HiAppEvent_Flush(uint32_t timeoutMs);
+
+/**
+ * @brief Get the number of events dropped in "async" write mode because the buffer quota was used up,
+ * or because the background writer failed to persist them.
+ *
+ * @return Returns the number of dropped events since the process started.
+ * @since 21
+ */
+uint64_t OH_HiAppEvent_GetDroppedEventCount(void);
+
 /**
  * @brief Implements the configuration function of application events logging.
  *
@@ -615,6 +716,79 @@ int OH_HiAppEvent_SetWatcherOnReceive(HiAppEvent_Watcher* watcher, OH_HiAppEvent
  */
 int OH_HiAppEvent_TakeWatcherData(HiAppEvent_Watcher* watcher, uint32_t eventNum, OH_HiAppEvent_OnTake onTake);
 
+/**
+ * @brief The interface to set onReceiveBatch callback for watcher. When the watcher receives app events, they are
+ * delivered as packed binary batches instead of json strings. It replaces the callback set by
+ * OH_HiAppEvent_SetWatcherOnReceive.
+ *
+ * @param watcher The pointer to the HiAppEvent_Watcher instance.
+ * @param onReceiveBatch The callback of the watcher.
+ * @return Returns 0 if set OnReceiveBatch is successful, and returns a
+ * negative integer if set fail.
+ *         {@code 0} Success.
+ *         {@code -5} The watcher is nullptr.
+ * @since 21
+ */
+int OH_HiAppEvent_SetWatcherOnReceiveBatch(HiAppEvent_Watcher* watcher, OH_HiAppEvent_OnReceiveBatch onReceiveBatch);
+
+/**
+ * @brief The interface to take saved events data for the watcher as packed binary batches.
+ *
+ * The saved events are delivered in successive batches, each of which takes at most maxBytes of memory,
+ * until all saved events are taken, so a large backlog can be drained with bounded memory.
+ *
+ * @param watcher The pointer to the HiAppEvent_Watcher instance.
+ * @param maxBytes The maximum memory of one batch, which ranges from 4096 to 16777216 bytes.
+ * @param onTake The callback invoked for each batch.
+ * @return Returns 0 if take events is successful, and returns a
+ * negative integer if take fail.
+ *         {@code 0} Success.
+ *         {@code -5} The watcher is nullptr.
+ *         {@code -6} This interface must be called after OH_HiAppEvent_AddWatcher.
+ *         {@link HIAPPEVENT_INVALID_PARAM_VALUE} The maxBytes is out of range.
+ * @since 21
+ */
+int OH_HiAppEvent_TakeWatcherBatch(HiAppEvent_Watcher* watcher, uint32_t maxBytes,
+    OH_HiAppEvent_OnReceiveBatch onTake);
+
+/**
+ * @brief Get the number of event groups in an event batch.
+ *
+ * @param batch The pointer to the event batch.
+ * @return Returns the number of groups; returns 0 if batch is nullptr.
+ * @since 21
+ */
+uint32_t OH_HiAppEvent_GetBatchGroupCount(const HiAppEvent_EventBatch* batch);
+
+/**
+ * @brief Get an event group of an event batch.
+ *
+ * @param batch The pointer to the event batch.
+ * @param groupIndex The index of the group, less than the value of OH_HiAppEvent_GetBatchGroupCount.
+ * @param group The pointer to the group to be filled in, whose pointers are valid as long as the batch.
+ * @return get result.
+ *         {@link HIAPPEVENT_SUCCESS} The operation is successful.
+ *         {@link HIAPPEVENT_INVALID_PARAM_VALUE} The batch or group is nullptr, or the index is out of range.
+ * @since 21
+ */
+int OH_HiAppEvent_GetBatchGroup(const HiAppEvent_EventBatch* batch, uint32_t groupIndex,
+    HiAppEvent_BatchGroup* group);
+
+/**
+ * @brief Get a parameter column of an event group in an event batch.
+ *
+ * @param batch The pointer to the event batch.
+ * @param groupIndex The index of the group.
+ * @param columnIndex The index of the column, less than the columnCount of the group.
+ * @param column The pointer to the column to be filled in, whose pointers are valid as long as the batch.
+ * @return get result.
+ *         {@link HIAPPEVENT_SUCCESS} The operation is successful.
+ *         {@link HIAPPEVENT_INVALID_PARAM_VALUE} The batch or column is nullptr, or an index is out of range.
+ * @since 21
+ */
+int OH_HiAppEvent_GetBatchColumn(const HiAppEvent_EventBatch* batch, uint32_t groupIndex, uint32_t columnIndex,
+    HiAppEvent_BatchColumn* column);
+
 /**
  * @brief The interface to add the watcher. The watcher will start receiving app events after it is added.
  *
@@ -69,6 +69,33 @@ extern "C" {
  */
 #define MAX_STORAGE "max_storage"
 
+/**
+ * @brief Event write mode, which is "sync" or "async". The default value is "sync".
+ *
+ * In "async" mode, OH_HiAppEvent_Write only verifies the event and serializes it into a buffer of the
+ * calling thread. A background writer batches, compresses and persists the buffered events.
+ *
+ * @since 21
+ */
+#define WRITE_MODE "write_mode"
+
+/**
+ * @brief Interval at which the background writer flushes buffered events in "async" write mode,
+ * in milliseconds. The value ranges from 100 to 60000, and the default value is "1000".
+ *
+ * @since 21
+ */
+#define ASYNC_FLUSH_INTERVAL "async_flush_interval"
+
+/**
+ * @brief Memory quota of all buffered events in "async" write mode, such as "512K" or "4M".
+ * The value ranges from 64K to 16M, and the default value is "1M". Events written while the quota is
+ * used up are dropped and counted.
+ *
+ * @since 21
+ */
+#define ASYNC_BUFFER_SIZE "async_buffer_size"
+
 #ifdef __cplusplus
 }
 #endif
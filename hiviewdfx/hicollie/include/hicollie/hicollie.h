@@ -82,6 +82,16 @@ typedef enum HiCollie_ErrorCode {
      * @since 18
      */
     HICOLLIE_WRONG_TIMER_ID_OUTPUT_PARAM = 29800006,
+    /**
+     * The jank histogram is not enabled
+     * @since 21
+     */
+    HICOLLIE_JANK_HISTOGRAM_NOT_ENABLED = 29800007,
+    /**
+     * Jank detection is not initialized
+     * @since 21
+     */
+    HICOLLIE_JANK_DETECTION_NOT_INITIALIZED = 29800008,
 } HiCollie_ErrorCode;
 
 /**
@@ -253,6 +263,114 @@ HiCollie_ErrorCode OH_HiCollie_SetTimer(HiCollie_SetTimerParam param, int *id);
  */
 void OH_HiCollie_CancelTimer(int id);
 
+/**
+ * @brief Max length of the section name in {@link HiCollie_JankSection}, including the terminating null byte.
+ *
+ * @since 21
+ */
+#define HICOLLIE_JANK_SECTION_NAME_LEN 64
+
+/**
+ * @brief Defines the input parameter for {@link OH_HiCollie_EnableJankHistogram}
+ *
+ * @since 21
+ */
+typedef struct HiCollie_JankHistogramParam {
+    /** The length of one rolling window in seconds, 0 means the default value 10 seconds */
+    uint32_t windowSeconds;
+    /** The number of rolling windows kept, 0 means the default value 6 */
+    uint32_t windowCount;
+    /** The frame duration in milliseconds exceed which a frame is counted as jank,
+     * 0 means the default value 16 milliseconds */
+    uint32_t jankThreshold;
+    /** The significant decimal digits of recorded durations, the value range is 1 to 3,
+     * 0 means the default value 2 */
+    uint32_t significantDigits;
+} HiCollie_JankHistogramParam;
+
+/**
+ * @brief Defines the frame duration distribution returned by {@link OH_HiCollie_GetJankStat}
+ *
+ * @since 21
+ */
+typedef struct HiCollie_JankStat {
+    /** The number of frames recorded */
+    uint64_t frameCount;
+    /** The number of frames exceed the jank threshold */
+    uint64_t jankCount;
+    /** The 50th percentile of frame duration in microseconds */
+    uint64_t p50;
+    /** The 90th percentile of frame duration in microseconds */
+    uint64_t p90;
+    /** The 99th percentile of frame duration in microseconds */
+    uint64_t p99;
+    /** The max frame duration in microseconds */
+    uint64_t max;
+} HiCollie_JankStat;
+
+/**
+ * @brief Defines the attribution of jank frames to a trace section
+ *
+ * @since 21
+ */
+typedef struct HiCollie_JankSection {
+    /** The name of the section started by OH_HiTrace_StartTrace or OH_HiTrace_StartTraceEx */
+    char name[HICOLLIE_JANK_SECTION_NAME_LEN];
+    /** The number of jank frames during which the section was active */
+    uint64_t jankCount;
+    /** The time in microseconds the section overlapped with jank frames */
+    uint64_t jankTime;
+} HiCollie_JankSection;
+
+/**
+ * @brief Aggregate the durations between {@link OH_HiCollie_BeginFunc} and {@link OH_HiCollie_EndFunc}
+ * into HDR histograms over rolling windows. The trace sections started on the business thread are
+ * recorded while a frame is in progress, so slow frames can be attributed to them.
+ * It should be called after {@link OH_HiCollie_Init_JankDetection}.
+ *
+ * @param param The parameter for jank histogram setting.
+ * @return {@link HICOLLIE_SUCCESS} 0 - Success.
+ *         {@link HICOLLIE_INVALID_ARGUMENT} 401 - param is NULL or the significantDigits is greater than 3.
+ *         {@link HICOLLIE_JANK_DETECTION_NOT_INITIALIZED} 29800008 - Jank detection is not initialized by
+ *              {@link OH_HiCollie_Init_JankDetection}.
+ * @since 21
+ */
+HiCollie_ErrorCode OH_HiCollie_EnableJankHistogram(const HiCollie_JankHistogramParam *param);
+
+/**
+ * @brief Stop aggregating frame durations and release the histograms.
+ *
+ * @since 21
+ */
+void OH_HiCollie_DisableJankHistogram(void);
+
+/**
+ * @brief Obtain the frame duration distribution of the most recent windows.
+ *
+ * @param windowCount The number of most recent windows to be merged, 0 means all windows kept.
+ * @param stat The pointer used to save the distribution, it should not be NULL.
+ * @return {@link HICOLLIE_SUCCESS} 0 - Success.
+ *         {@link HICOLLIE_INVALID_ARGUMENT} 401 - stat is NULL.
+ *         {@link HICOLLIE_JANK_HISTOGRAM_NOT_ENABLED} 29800007 - The jank histogram is not enabled.
+ * @since 21
+ */
+HiCollie_ErrorCode OH_HiCollie_GetJankStat(uint32_t windowCount, HiCollie_JankStat *stat);
+
+/**
+ * @brief Obtain the trace sections most often active during jank frames of the most recent windows,
+ * sorted by jankTime in descending order.
+ *
+ * @param windowCount The number of most recent windows to be merged, 0 means all windows kept.
+ * @param sections The array used to save the sections.
+ * @param count As input, the number of elements in sections; as output, the number of sections saved.
+ * @return {@link HICOLLIE_SUCCESS} 0 - Success.
+ *         {@link HICOLLIE_INVALID_ARGUMENT} 401 - sections or count is NULL.
+ *         {@link HICOLLIE_JANK_HISTOGRAM_NOT_ENABLED} 29800007 - The jank histogram is not enabled.
+ * @since 21
+ */
+HiCollie_ErrorCode OH_HiCollie_GetJankSections(uint32_t windowCount, HiCollie_JankSection *sections,
+    uint32_t *count);
+
 #ifdef __cplusplus
 }
 #endif
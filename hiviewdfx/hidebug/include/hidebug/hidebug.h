@@ -167,6 +167,8 @@ HiDebug_ErrorCode OH_HiDebug_GetGraphicsMemory(uint32_t *value);
 
 /**
  * @brief Replace MallocDispatch table with developer-defined memory allocation functions.
+ *        While the heap profiler is running, the table is installed beneath the profiler,
+ *        see {@link OH_HiDebug_StartHeapProfiler}.
  *
  * @param dispatchTable A pointer to the MallocDispatch table.
  * @return Result code
@@ -187,6 +189,8 @@ HiDebug_MallocDispatch* OH_HiDebug_GetDefaultMallocDispatchTable(void);
 
 /**
  * @brief Restore original MallocDispatch table.
+ *        While the heap profiler is running, the original table is restored beneath the profiler,
+ *        see {@link OH_HiDebug_StartHeapProfiler}.
  *
  * @since 20
  */
@@ -261,6 +265,168 @@ void OH_HiDebug_DestroyBacktraceObject(HiDebug_Backtrace_Object object);
  */
 HiDebug_ErrorCode OH_HiDebug_GetGraphicsMemorySummary(uint32_t interval, HiDebug_GraphicsMemorySummary *summary);
 
+/**
+ * @brief Start the sampling profiler of native threads. Stacks are unwound by frame pointer in a
+ *        per-thread cpu-time timer signal and recorded into a lock-free buffer without symbolization.
+ *
+ * @param config Indicates the pointer to {@link HiDebug_ProfilerConfig}.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The sampling profiler is started.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, config is null or the frequency is out of range.
+ *         {@link HIDEBUG_PROFILER_STARTED_ALREADY} Have already started the sampling profiler.
+ *         {@link HIDEBUG_TRACE_ABNORMAL} Failed to start the sampling profiler due to a system error.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_StartProfiler(const HiDebug_ProfilerConfig *config);
+
+/**
+ * @brief Stop the sampling profiler, aggregate the recorded samples and write them to the given file.
+ *        Symbolization is done in the calling thread, so the function is not signal-safe.
+ *
+ * @param format Output format, see {@link HiDebug_ProfilerOutputFormat}.
+ * @param fd File descriptor opened for writing by the caller.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The sampling profiler is stopped and the result is written.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, format or fd is invalid.
+ *         {@link HIDEBUG_NO_PERMISSION} Failed to write to the fd.
+ *         {@link HIDEBUG_NO_PROFILER_RUNNING} No sampling profiler running.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_StopProfiler(HiDebug_ProfilerOutputFormat format, int fd);
+
+/**
+ * @brief Obtain the statistics of the running sampling profiler.
+ *
+ * @param stat Indicates the pointer to {@link HiDebug_ProfilerStat}.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} Get the statistics success.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, stat is null.
+ *         {@link HIDEBUG_NO_PROFILER_RUNNING} No sampling profiler running.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_GetProfilerStat(HiDebug_ProfilerStat *stat);
+
+/**
+ * @brief Start the sampling heap profiler. The profiler installs its own MallocDispatch table which
+ *        forwards to the table in use, and records the frame pointer stack of sampled allocations only,
+ *        so unsampled allocations pay a counter decrement.
+ *        While the profiler runs, {@link OH_HiDebug_SetMallocDispatchTable} replaces the table the profiler
+ *        forwards to and {@link OH_HiDebug_RestoreMallocDispatchTable} makes it forward to the original table,
+ *        so the profiler hooks stay installed.
+ *
+ * @param config Indicates the pointer to {@link HiDebug_HeapProfilerConfig}, NULL means the default value.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The heap profiler is started.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, the maxDepth is out of range.
+ *         {@link HIDEBUG_PROFILER_STARTED_ALREADY} Have already started the heap profiler.
+ *         {@link HIDEBUG_TRACE_ABNORMAL} Failed to start the heap profiler due to a system error.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_StartHeapProfiler(const HiDebug_HeapProfilerConfig *config);
+
+/**
+ * @brief Stop the heap profiler and install the MallocDispatch table it forwards to at that time, which is
+ *        the table in use before it was started unless it has been replaced while the profiler was running.
+ *        Snapshots taken before remain valid.
+ *
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The heap profiler is stopped.
+ *         {@link HIDEBUG_NO_PROFILER_RUNNING} No heap profiler running.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_StopHeapProfiler(void);
+
+/**
+ * @brief Take a snapshot of the sampled allocations.
+ *
+ * @param snapshot Output snapshot, must be released by {@link OH_HiDebug_ReleaseHeapSnapshot}.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The snapshot is taken.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, snapshot is null.
+ *         {@link HIDEBUG_NO_PROFILER_RUNNING} No heap profiler running.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_TakeHeapSnapshot(HiDebug_HeapSnapshot *snapshot);
+
+/**
+ * @brief Symbolize a heap snapshot and write it to the given file. If base is not NULL, the difference
+ *        from base to snapshot is written, which shows the growth between the two snapshots.
+ *
+ * @param snapshot The snapshot taken by {@link OH_HiDebug_TakeHeapSnapshot}.
+ * @param base The snapshot to be subtracted, maybe NULL.
+ * @param view The view to be written, see {@link HiDebug_HeapProfileView}.
+ * @param format Output format, see {@link HiDebug_ProfilerOutputFormat}.
+ * @param fd File descriptor opened for writing by the caller.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The snapshot is written.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, snapshot, view, format or fd is invalid.
+ *         {@link HIDEBUG_NO_PERMISSION} Failed to write to the fd.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_DumpHeapSnapshot(HiDebug_HeapSnapshot snapshot, HiDebug_HeapSnapshot base,
+    HiDebug_HeapProfileView view, HiDebug_ProfilerOutputFormat format, int fd);
+
+/**
+ * @brief Release a heap snapshot.
+ *
+ * @param snapshot The snapshot to be released.
+ * @since 21
+ */
+void OH_HiDebug_ReleaseHeapSnapshot(HiDebug_HeapSnapshot snapshot);
+
+/**
+ * @brief Obtain the statistics of the running heap profiler.
+ *
+ * @param stat Indicates the pointer to {@link HiDebug_HeapProfilerStat}.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} Get the statistics success.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, stat is null.
+ *         {@link HIDEBUG_NO_PROFILER_RUNNING} No heap profiler running.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_GetHeapProfilerStat(HiDebug_HeapProfilerStat *stat);
+
+/**
+ * @brief Defines the callback of the {@link OH_HiDebug_SubscribeThreadCpuUsage} function.
+ *
+ * @param deltas The cpu usage deltas of the threads, the content is invalid after return of the callback.
+ * @param count The number of elements in deltas.
+ * @param interval The actual length of the interval, in milliseconds.
+ * @param arg The arg pass to {@link OH_HiDebug_SubscribeThreadCpuUsage}.
+ * @since 21
+ */
+typedef void (*OH_HiDebug_ThreadCpuUsageCallback)(const HiDebug_ThreadCpuDelta* deltas, uint32_t count,
+    uint32_t interval, void* arg);
+
+/**
+ * @brief Subscribe the cpu usage deltas of application's all thread. The per-thread stat files are kept open
+ *        and read into a table preallocated for maxThreadCount threads, so no memory is allocated per sample.
+ *        The callback is invoked every interval in an independent thread.
+ *
+ * @param interval The interval between two callbacks, in milliseconds. The value range is 50 to 60000.
+ * @param maxThreadCount The capacity of the table, threads beyond the capacity are not reported.
+ * @param callback The function to pass the deltas to caller.
+ * @param arg The arg will be pass to callback.
+ * @param subscription Output subscription, must be released by {@link OH_HiDebug_UnsubscribeThreadCpuUsage}.
+ * @return Result code
+ *         {@link HIDEBUG_SUCCESS} The subscription is created.
+ *         {@link HIDEBUG_INVALID_ARGUMENT} Invalid argument, the interval is out of range, maxThreadCount is 0,
+ *         callback or subscription is null.
+ *         {@link HIDEBUG_TRACE_ABNORMAL} Failed to create the subscription due to a system error.
+ * @since 21
+ */
+HiDebug_ErrorCode OH_HiDebug_SubscribeThreadCpuUsage(uint32_t interval, uint32_t maxThreadCount,
+    OH_HiDebug_ThreadCpuUsageCallback callback, void* arg, HiDebug_ThreadCpuSubscription* subscription);
+
+/**
+ * @brief Cancel a thread cpu usage subscription. The callback is not invoked after return of the function,
+ *        so the function should not be called in the callback.
+ *
+ * @param subscription The subscription to be canceled.
+ * @since 21
+ */
+void OH_HiDebug_UnsubscribeThreadCpuUsage(HiDebug_ThreadCpuSubscription subscription);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
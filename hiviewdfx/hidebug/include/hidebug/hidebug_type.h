@@ -68,6 +68,16 @@ typedef enum HiDebug_ErrorCode {
      * @since 20
      */
     HIDEBUG_INVALID_SYMBOLIC_PC_ADDRESS = 11400200,
+    /**
+     * Have already started the sampling profiler
+     * @since 21
+     */
+    HIDEBUG_PROFILER_STARTED_ALREADY = 11400201,
+    /**
+     * No sampling profiler running
+     * @since 21
+     */
+    HIDEBUG_NO_PROFILER_RUNNING = 11400202,
 } HiDebug_ErrorCode;
 
 /**
@@ -330,6 +340,172 @@ typedef struct HiDebug_GraphicsMemorySummary {
     uint32_t graph;
 } HiDebug_GraphicsMemorySummary;
 
+/**
+ * @brief Enum for the output format of the sampling profiler.
+ *
+ * @since 21
+ */
+typedef enum HiDebug_ProfilerOutputFormat {
+    /** Folded stacks, one "frame;frame;frame count" line per unique stack */
+    HIDEBUG_PROFILER_OUTPUT_FOLDED = 1,
+    /** Gzip compressed pprof profile.proto */
+    HIDEBUG_PROFILER_OUTPUT_PPROF = 2,
+} HiDebug_ProfilerOutputFormat;
+
+/**
+ * @brief Defines the configuration of the sampling profiler.
+ *
+ * @since 21
+ */
+typedef struct HiDebug_ProfilerConfig {
+    /**
+     * Sampling frequency of each thread, in hertz. The value range is 1 to 1000
+     */
+    uint32_t frequency;
+
+    /**
+     * Ids of the threads to be sampled, NULL means all threads of the application process
+     */
+    const pid_t* threadIds;
+
+    /**
+     * Number of elements in threadIds
+     */
+    uint32_t threadIdCount;
+
+    /**
+     * Max number of frames recorded in one sample, 0 means the default value 64
+     */
+    uint32_t maxDepth;
+
+    /**
+     * Size of the sample buffer, in kibibytes, 0 means the default value 1024.
+     * Samples are dropped instead of blocking when the buffer is full
+     */
+    uint32_t bufferSize;
+} HiDebug_ProfilerConfig;
+
+/**
+ * @brief Defines the statistics of the sampling profiler.
+ *
+ * @since 21
+ */
+typedef struct HiDebug_ProfilerStat {
+    /**
+     * Number of samples recorded in the buffer
+     */
+    uint64_t sampleCount;
+
+    /**
+     * Number of samples dropped because the buffer was full
+     */
+    uint64_t droppedCount;
+
+    /**
+     * Number of samples whose stack was truncated at maxDepth
+     */
+    uint64_t truncatedCount;
+
+    /**
+     * Total time spent in the sampling signal handler, in nanoseconds
+     */
+    uint64_t handlerTime;
+} HiDebug_ProfilerStat;
+
+/**
+ * @brief Defines the configuration of the heap profiler.
+ *
+ * @since 21
+ */
+typedef struct HiDebug_HeapProfilerConfig {
+    /**
+     * Mean number of bytes allocated between two samples, 0 means the default value 512 KiB.
+     * The distance to the next sample is drawn from an exponential distribution, so allocations
+     * of any size are sampled with a probability proportional to their size
+     */
+    uint64_t sampleInterval;
+
+    /**
+     * Max number of frames recorded in one sample, 0 means the default value 64
+     */
+    uint32_t maxDepth;
+} HiDebug_HeapProfilerConfig;
+
+/**
+ * @brief Enum for the view of a heap snapshot.
+ *
+ * @since 21
+ */
+typedef enum HiDebug_HeapProfileView {
+    /** Objects that are allocated and not yet freed */
+    HIDEBUG_HEAP_PROFILE_LIVE = 1,
+    /** All allocations made since the heap profiler was started */
+    HIDEBUG_HEAP_PROFILE_ALLOC = 2,
+} HiDebug_HeapProfileView;
+
+/**
+ * @brief To represent a heap snapshot
+ *
+ * @since 21
+ */
+typedef struct HiDebug_HeapSnapshot__* HiDebug_HeapSnapshot;
+
+/**
+ * @brief Defines the statistics of the heap profiler.
+ *
+ * @since 21
+ */
+typedef struct HiDebug_HeapProfilerStat {
+    /**
+     * Number of sampled allocations
+     */
+    uint64_t sampledCount;
+
+    /**
+     * Estimated bytes of live objects, scaled from the sampled allocations
+     */
+    uint64_t liveBytes;
+
+    /**
+     * Estimated bytes allocated since the heap profiler was started, scaled from the sampled allocations
+     */
+    uint64_t allocatedBytes;
+
+    /**
+     * Number of sampled allocations dropped because the sample table was full
+     */
+    uint64_t droppedCount;
+} HiDebug_HeapProfilerStat;
+
+/**
+ * @brief Defines the cpu usage delta of a thread within one subscription interval.
+ *
+ * @since 21
+ */
+typedef struct HiDebug_ThreadCpuDelta {
+    /**
+     * Thread id
+     */
+    uint32_t threadId;
+
+    /**
+     * Cpu time consumed by the thread within the interval, in microseconds
+     */
+    uint64_t cpuTime;
+
+    /**
+     * Cpu usage of the thread within the interval
+     */
+    double cpuUsage;
+} HiDebug_ThreadCpuDelta;
+
+/**
+ * @brief To represent a thread cpu usage subscription
+ *
+ * @since 21
+ */
+typedef struct HiDebug_ThreadCpuSubscription__* HiDebug_ThreadCpuSubscription;
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -383,6 +383,83 @@ void OH_LOG_SetMinLogLevel(LogLevel level);
  */
 void OH_LOG_SetLogLevel(LogLevel level, PreferStrategy prefer);
 
+/**
+ * @brief Outputs logs in binary form, deferring the formatting.
+ *
+ * Instead of formatting on the calling thread, this function records the log level, service domain, log tag,
+ * an ID of the format string and the raw parameters into a lock-free ring buffer of the calling thread.
+ * The record is formatted later by the log reader, or offline with the format string table of the process,
+ * and is then output like a log of {@link OH_LOG_Print}. If the ring buffer is full, the log is dropped
+ * and counted, see {@link OH_LOG_GetBinaryDroppedCount}. \n
+ * The level filter is applied before recording, so a log that cannot be output costs only the filter check.
+ * Parameters of <b>%s</b> are copied at call time; all other parameters are stored by value.
+ * The format string and the log tag are interned into the format string table of the process the first time
+ * their address is seen, and records refer to the table entry. Records of a module therefore stay readable
+ * after the module is unloaded by <b>dlclose</b>, and the entries of an unloaded module are dropped,
+ * so an address reused by a module loaded later is interned again.
+ *
+ * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
+ * @param level Indicates the log level, which can be <b>LOG_DEBUG</b>, <b>LOG_INFO</b>, <b>LOG_WARN</b>,
+ * <b>LOG_ERROR</b>, and <b>LOG_FATAL</b>.
+ * @param domain Indicates the service domain of logs. Its value is a hexadecimal integer ranging from 0x0 to 0xFFFF.
+ * @param tag Indicates the log tag, which is a string used to identify the class, file, or service behavior.
+ * It must be a string literal, such as {@link LOG_TAG}, because it is interned by address and must not change
+ * after the first call. Use {@link OH_LOG_Print} for a tag built at run time.
+ * @param fmt Indicates the format string, which must be a string literal, because it is interned by address
+ * and must not change after the first call. It supports the privacy identifier as {@link OH_LOG_Print} does.
+ * @param ... Indicates a list of parameters. The number and type of parameters must map onto the format specifiers
+ * in the format string.
+ * @return Returns <b>0</b> or a larger value if the log is recorded or filtered out; returns a value smaller
+ * than <b>0</b> if it is dropped or the parameters are invalid.
+ * @since 21
+ */
+int OH_LOG_PrintBinary(LogType type, LogLevel level, unsigned int domain, const char *tag, const char *fmt, ...)
+    __attribute__((__format__(os_log, 5, 6)));
+
+/**
+ * @brief Outputs logs in binary form at the specified level. This is a function-like macro.
+ *
+ * Define the log service domain and log tag before use, as for {@link OH_LOG_INFO}.
+ *
+ * @param type Indicates the log type. The type for third-party applications is defined by {@link LOG_APP}.
+ * @param level Indicates the log level.
+ * @param fmt Indicates the format string literal, followed by its parameters.
+ * @see OH_LOG_PrintBinary
+ * @since 21
+ */
+#define OH_LOG_BINARY(type, level, ...) ((void)OH_LOG_PrintBinary((type), (level), LOG_DOMAIN, LOG_TAG, __VA_ARGS__))
+
+/**
+ * @brief Sets the size of the binary log ring buffer of each thread.
+ *
+ * The size applies to ring buffers created after this call, that is, to threads that have not output a binary
+ * log yet.
+ *
+ * @param size Indicates the ring buffer size, in bytes. The value ranges from 4096 to 1048576,
+ * and the default value is 65536.
+ * @return Returns <b>0</b> if the operation is successful; returns a value smaller than <b>0</b> otherwise.
+ * @since 21
+ */
+int OH_LOG_SetBinaryBufferSize(size_t size);
+
+/**
+ * @brief Formats and outputs all binary logs recorded so far in the current process.
+ *
+ * The function returns after the records of all threads have been handed to the log reader.
+ * Call it before the process exits or crashes to avoid losing the logs still held in ring buffers.
+ *
+ * @since 21
+ */
+void OH_LOG_FlushBinary(void);
+
+/**
+ * @brief Obtains the number of binary logs dropped in the current process because a ring buffer was full.
+ *
+ * @return Returns the number of dropped binary logs.
+ * @since 21
+ */
+size_t OH_LOG_GetBinaryDroppedCount(void);
+
 #ifdef __cplusplus
 }
 #endif
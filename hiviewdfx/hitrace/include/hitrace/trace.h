@@ -809,6 +809,250 @@ void OH_HiTrace_CountTraceEx(HiTrace_Output_Level level, const char* name, int64
  */
 bool OH_HiTrace_IsTraceEnabled(void);
 
+/**
+ * @brief Defines a static trace category.
+ *
+ * A category is defined once at file scope with {@link OH_HITRACE_DEFINE_CATEGORY} and registered
+ * before <b>main</b> runs. The system sets <b>enabled</b> when trace capture is running for the category and
+ * {@link OH_HiTrace_IsTraceEnabled} is true, or while the in-process recorder started by
+ * {@link OH_HiTrace_StartRecorder} is running, so a disabled tracepoint costs one load and one branch.
+ *
+ * @struct HiTrace_Category
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+typedef struct HiTrace_Category {
+    /** Name of the category, which must have static storage duration. */
+    const char *name;
+    /** Whether the category is enabled. It is written by the system and must only be read by the application. */
+    volatile uint32_t enabled;
+    /** Reserved for the system, which must be initialized to 0. */
+    uint32_t reserved;
+} HiTrace_Category;
+
+/**
+ * @brief Registers a static trace category.
+ *
+ * Usually called by {@link OH_HITRACE_DEFINE_CATEGORY} and not directly.
+ *
+ * @param category Pointer to the category, which must have static storage duration.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+void OH_HiTrace_RegisterCategory(HiTrace_Category *category);
+
+/**
+ * @brief Defines and registers a static trace category. This is a function-like macro.
+ *
+ * Use it once at file scope, and declare the variable with <b>extern HiTrace_Category var;</b> in other files.
+ *
+ * @param var Name of the category variable.
+ * @param categoryName Name of the category, which must be a string literal.
+ *
+ * @since 21
+ */
+#define OH_HITRACE_DEFINE_CATEGORY(var, categoryName)                                   \
+    HiTrace_Category var = { (categoryName), 0, 0 };                                    \
+    __attribute__((constructor)) static void OH_HiTrace_RegisterCategory_##var(void)     \
+    {                                                                                   \
+        OH_HiTrace_RegisterCategory(&(var));                                            \
+    }                                                                                   \
+    extern HiTrace_Category var
+
+/**
+ * @brief Checks whether a static trace category is enabled. This is a function-like macro.
+ *
+ * @param category Category variable defined by {@link OH_HITRACE_DEFINE_CATEGORY}.
+ *
+ * @since 21
+ */
+#define OH_HITRACE_CATEGORY_ENABLED(category) (__builtin_expect((category).enabled != 0, 0))
+
+/**
+ * @brief Marks the start of a synchronous trace task in a static trace category.
+ *
+ * The event is written to a binary buffer of the calling thread instead of the trace marker file.
+ * Buffers are converted to the same output as {@link OH_HiTrace_StartTraceEx} in batches, keeping the
+ * original timestamps, when they are full, periodically, and when trace capture stops.
+ * Use {@link OH_HITRACE_BEGIN} rather than calling this API directly.
+ *
+ * @param category Pointer to the category.
+ * @param name Name of the synchronous trace task, which must have static storage duration.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+void OH_HiTrace_CategoryBegin(HiTrace_Category *category, const char *name);
+
+/**
+ * @brief Marks the end of a synchronous trace task in a static trace category.
+ *
+ * It is matched with the most recent <b>OH_HiTrace_CategoryBegin</b> of the calling thread, so it must be called
+ * exactly once for every recorded begin, even if the category has been disabled since, and must not be called
+ * for a begin that was skipped because the category was disabled. Ends of slices whose capture has stopped
+ * only close the slice and are not written.
+ * Use {@link OH_HITRACE_END} rather than calling this API directly.
+ *
+ * @param category Pointer to the category.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+void OH_HiTrace_CategoryEnd(HiTrace_Category *category);
+
+/**
+ * @brief Traces the value of an integer variable in a static trace category.
+ *
+ * Use {@link OH_HITRACE_COUNT} rather than calling this API directly.
+ *
+ * @param category Pointer to the category.
+ * @param name Name of the integer variable, which must have static storage duration.
+ * @param count Integer value.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+void OH_HiTrace_CategoryCount(HiTrace_Category *category, const char *name, int64_t count);
+
+/**
+ * @brief Writes the buffered static trace events of the calling thread to the trace output.
+ *
+ * Call it before a thread exits or blocks for a long time if its events are needed at once.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+void OH_HiTrace_FlushCategoryBuffer(void);
+
+/**
+ * @brief Marks the start of a synchronous trace task if the category is enabled. This is a function-like macro.
+ *
+ * It is an expression whose value tells whether the begin was recorded. Save the value and pass it to the
+ * matching {@link OH_HITRACE_END}, for example:
+ * <b>uint32_t token = OH_HITRACE_BEGIN(g_category, "load"); ... OH_HITRACE_END(g_category, token);</b>
+ * Sequential and nested trace tasks each use their own token.
+ *
+ * @param category Category variable defined by {@link OH_HITRACE_DEFINE_CATEGORY}.
+ * @param name Name of the synchronous trace task, which must be a string literal.
+ * @return Returns <b>1</b> if the begin was recorded, or <b>0</b> if the category was disabled.
+ *
+ * @since 21
+ */
+#define OH_HITRACE_BEGIN(category, name)                                        \
+    (OH_HITRACE_CATEGORY_ENABLED(category) ?                                    \
+        (OH_HiTrace_CategoryBegin(&(category), (name)), (uint32_t)1) : (uint32_t)0)
+
+/**
+ * @brief Marks the end of a synchronous trace task if its begin was recorded. This is a function-like macro.
+ *
+ * The end is written even if the category has been disabled since the begin, so the slice is always closed.
+ *
+ * @param category Category variable passed to the matching {@link OH_HITRACE_BEGIN}.
+ * @param token Value returned by the matching {@link OH_HITRACE_BEGIN}.
+ *
+ * @since 21
+ */
+#define OH_HITRACE_END(category, token)                              \
+    do {                                                             \
+        if ((token) != 0) {                                          \
+            OH_HiTrace_CategoryEnd(&(category));                     \
+        }                                                            \
+    } while (0)
+
+/**
+ * @brief Traces the value of an integer variable if the category is enabled. This is a function-like macro.
+ *
+ * @param category Category variable defined by {@link OH_HITRACE_DEFINE_CATEGORY}.
+ * @param name Name of the integer variable, which must be a string literal.
+ * @param count Integer value.
+ *
+ * @since 21
+ */
+#define OH_HITRACE_COUNT(category, name, count)                      \
+    do {                                                             \
+        if (OH_HITRACE_CATEGORY_ENABLED(category)) {                 \
+            OH_HiTrace_CategoryCount(&(category), (name), (count));  \
+        }                                                            \
+    } while (0)
+
+/**
+ * @brief Defines the configuration of the in-process trace recorder.
+ *
+ * @struct HiTrace_RecorderConfig
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+typedef struct HiTrace_RecorderConfig {
+    /** Size cap of the ring buffer, in kibibytes. The oldest packets are overwritten when the buffer is full. */
+    uint32_t bufferSize;
+    /** Minimum output level of the recorded events. */
+    HiTrace_Output_Level level;
+} HiTrace_RecorderConfig;
+
+/**
+ * @brief Starts the in-process trace recorder.
+ *
+ * While the recorder is running, the events of the calling process are also encoded as Perfetto
+ * <b>TracePacket</b> messages into a ring buffer. Synchronous and asynchronous trace tasks, including the
+ * static trace categories, are recorded as track events, integer variables as counter tracks, and the chain IDs
+ * and span IDs of {@link OH_HiTrace_BeginChain} and {@link OH_HiTrace_CreateSpan} as flows that link the events
+ * of one chain across threads. The events are recorded no matter whether trace capture is running: the recorder
+ * sets the <b>enabled</b> flag of every registered category, including categories registered later, until
+ * {@link OH_HiTrace_StopRecorder} is called.
+ *
+ * @param config Pointer to the recorder configuration.
+ *
+ * @return Returns <b>0</b> if the recorder is started; returns <b>-1</b> if <b>config</b> is null or
+ *         <b>bufferSize</b> is <b>0</b>, or the recorder is already running.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+int OH_HiTrace_StartRecorder(const HiTrace_RecorderConfig *config);
+
+/**
+ * @brief Stops the in-process trace recorder.
+ *
+ * The recorded packets are kept until the recorder is started again, so they can still be written by
+ * {@link OH_HiTrace_WriteRecorder}.
+ *
+ * @return Returns <b>0</b> if the recorder is stopped; returns <b>-1</b> if the recorder is not running.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+int OH_HiTrace_StopRecorder(void);
+
+/**
+ * @brief Writes the recorded packets as a Perfetto trace file.
+ *
+ * The output is a serialized Perfetto <b>Trace</b> message, preceded by the track and interned data
+ * descriptors, which can be opened by the Perfetto UI or trace processor on any host.
+ * It can be called while the recorder is running, in which case a consistent snapshot of the buffer is written.
+ *
+ * @param fd File descriptor opened for writing by the caller.
+ *
+ * @return Returns the number of bytes written; returns <b>-1</b> if <b>fd</b> is invalid, nothing has been
+ *         recorded, or writing fails.
+ *
+ * @syscap SystemCapability.HiviewDFX.HiTrace
+ *
+ * @since 21
+ */
+int64_t OH_HiTrace_WriteRecorder(int fd);
+
 #ifdef __cplusplus
 }
 #endif
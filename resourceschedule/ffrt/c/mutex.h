@@ -36,6 +36,7 @@
 #ifndef FFRT_API_C_MUTEX_H
 #define FFRT_API_C_MUTEX_H
 
+#include <stdbool.h>
 #include "type_def.h"
 
 /**
@@ -71,6 +72,29 @@ FFRT_C_API int ffrt_mutexattr_settype(ffrt_mutexattr_t* attr, int type);
  */
 FFRT_C_API int ffrt_mutexattr_gettype(ffrt_mutexattr_t* attr, int* type);
 
+/**
+ * @brief Sets the waiting policy of a mutex attribute.
+ *
+ * @param attr Indicates a pointer to the mutex attribute.
+ * @param policy Indicates a int to the lock policy.
+ * @return Returns <b>ffrt_success</b> if the mutex attribute policy is set successfully;
+           returns <b>ffrt_error_inval</b> if <b>attr</b> is a null pointer or
+           the policy is not <b>ffrt_lock_policy_park</b> or <b>ffrt_lock_policy_adaptive_spin</b>.
+ * @since 21
+ */
+FFRT_C_API int ffrt_mutexattr_setpolicy(ffrt_mutexattr_t* attr, int policy);
+
+/**
+ * @brief Gets the waiting policy of a mutex attribute.
+ *
+ * @param attr Indicates a pointer to the mutex attribute.
+ * @param policy Indicates a pointer to the lock policy.
+ * @return Returns <b>ffrt_success</b> if the mutex attribute policy is get successfully;
+           returns <b>ffrt_error_inval</b> if <b>attr</b> or <b>policy</b> is a null pointer.
+ * @since 21
+ */
+FFRT_C_API int ffrt_mutexattr_getpolicy(ffrt_mutexattr_t* attr, int* policy);
+
 /**
  * @brief Destroys a mutex attribute, the user needs to invoke this interface.
  *
@@ -132,5 +156,47 @@ FFRT_C_API int ffrt_mutex_trylock(ffrt_mutex_t* mutex);
  */
 FFRT_C_API int ffrt_mutex_destroy(ffrt_mutex_t* mutex);
 
+/**
+ * @brief Enables or disables the lock profiler.
+ *
+ * When enabled, every contended ffrt_mutex_t and ffrt_rwlock_t records its wait time, hold time and
+ * owner task name. Profiling is disabled by default and costs nothing when disabled.
+ *
+ * @param enable Indicates whether to enable the lock profiler.
+ * @since 21
+ */
+FFRT_C_API void ffrt_lock_profiler_enable(bool enable);
+
+/**
+ * @brief Gets the contention profile of a lock.
+ *
+ * @param lock Indicates the address of the ffrt_mutex_t or ffrt_rwlock_t.
+ * @param profile Indicates a pointer to the profile to be filled in.
+ * @return Returns <b>ffrt_success</b> if the profile is obtained;
+           returns <b>ffrt_error_inval</b> if <b>lock</b> has no profile or <b>profile</b> is a null pointer.
+ * @since 21
+ */
+FFRT_C_API int ffrt_lock_profiler_get(const void* lock, ffrt_lock_profile_t* profile);
+
+/**
+ * @brief Gets the contention profiles of all profiled locks.
+ *
+ * Profiles are sorted by <b>total_wait_ns</b> in descending order.
+ *
+ * @param profiles Indicates an array to receive the profiles.
+ * @param count Indicates the number of elements in <b>profiles</b>.
+ * @return Returns the number of profiled locks, which may exceed <b>count</b>;
+           only the first <b>count</b> profiles are written.
+ * @since 21
+ */
+FFRT_C_API uint32_t ffrt_lock_profiler_dump(ffrt_lock_profile_t* profiles, uint32_t count);
+
+/**
+ * @brief Clears all profiles recorded by the lock profiler.
+ *
+ * @since 21
+ */
+FFRT_C_API void ffrt_lock_profiler_reset(void);
+
 #endif // FFRT_API_C_MUTEX_H
 /** @} */
\ No newline at end of file
@@ -179,6 +179,59 @@ FFRT_C_API void ffrt_queue_attr_set_thread_mode(ffrt_queue_attr_t* attr, bool mo
  */
 FFRT_C_API bool ffrt_queue_attr_get_thread_mode(const ffrt_queue_attr_t* attr);
 
+/**
+ * @brief Sets the scheduling policy of a queue attribute.
+ *
+ * @param attr Queue attribute pointer.
+ * @param policy Indicates the scheduling policy, which is <b>ffrt_queue_sched_priority</b> by default.
+ * @since 21
+ */
+FFRT_C_API void ffrt_queue_attr_set_sched_policy(ffrt_queue_attr_t* attr, ffrt_queue_sched_policy_t policy);
+
+/**
+ * @brief Gets the scheduling policy of a queue attribute.
+ *
+ * @param attr Queue attribute pointer.
+ * @return Returns the scheduling policy.
+ * @since 21
+ */
+FFRT_C_API ffrt_queue_sched_policy_t ffrt_queue_attr_get_sched_policy(const ffrt_queue_attr_t* attr);
+
+/**
+ * @brief Sets the deadline miss callback of a queue attribute.
+ *
+ * The callback is invoked on the worker thread right after a task finishes later than its deadline.
+ *
+ * @warning Do not block in `cb` - this delays the following tasks of the queue.
+ * @param attr Queue attribute pointer.
+ * @param cb Indicates the deadline miss callback, or a null pointer to unregister.
+ * @param data Indicates the user data passed to the callback.
+ * @since 21
+ */
+FFRT_C_API void ffrt_queue_attr_set_deadline_miss_callback(ffrt_queue_attr_t* attr, ffrt_deadline_miss_cb cb,
+    void* data);
+
+/**
+ * @brief Sets the CPU cluster of a queue attribute.
+ *
+ * Tasks of the queue only run on workers of the cluster, which keeps cache-sensitive work on one cluster.
+ * The cluster must intersect the worker group of the queue QoS.
+ *
+ * @param attr Queue attribute pointer.
+ * @param cluster_id Indicates the cluster ID obtained by ffrt_get_cpu_clusters, or <b>-1</b> for no binding.
+ * @since 21
+ */
+FFRT_C_API void ffrt_queue_attr_set_cluster(ffrt_queue_attr_t* attr, int cluster_id);
+
+/**
+ * @brief Gets the CPU cluster of a queue attribute.
+ *
+ * @param attr Queue attribute pointer.
+ * @return Returns the cluster ID, which is <b>-1</b> by default.
+ * @since 21
+ */
+FFRT_C_API int ffrt_queue_attr_get_cluster(const ffrt_queue_attr_t* attr);
+
 /**
  * @brief Creates a queue.
  *
@@ -279,6 +332,17 @@ FFRT_C_API void ffrt_queue_wait(ffrt_task_handle_t handle);
  */
 FFRT_C_API int ffrt_queue_cancel(ffrt_task_handle_t handle);
 
+/**
+ * @brief Gets the deadline statistics of a queue.
+ *
+ * @param queue Indicates a queue handle.
+ * @param stat Indicates a pointer to the statistics to be filled in.
+ * @return Returns <b>ffrt_success</b> if the statistics are obtained;
+           returns <b>ffrt_error_inval</b> if <b>queue</b> or <b>stat</b> is invalid.
+ * @since 21
+ */
+FFRT_C_API int ffrt_queue_get_deadline_stat(ffrt_queue_t queue, ffrt_deadline_stat_t* stat);
+
 /**
  * @brief Gets the application main thread queue.
  *
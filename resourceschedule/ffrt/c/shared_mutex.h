@@ -38,6 +38,49 @@
 
 #include "type_def.h"
 
+/**
+ * @brief Initializes a rwlock attribute.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @return Returns <b>ffrt_success</b> if the rwlock attribute is initialized;
+           returns <b>ffrt_error_inval</b> otherwise.
+ * @since 21
+ */
+FFRT_C_API int ffrt_rwlockattr_init(ffrt_rwlockattr_t* attr);
+
+/**
+ * @brief Sets the waiting policy of a rwlock attribute.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @param policy Indicates a int to the lock policy.
+ * @return Returns <b>ffrt_success</b> if the rwlock attribute policy is set successfully;
+           returns <b>ffrt_error_inval</b> if <b>attr</b> is a null pointer or
+           the policy is not <b>ffrt_lock_policy_park</b> or <b>ffrt_lock_policy_adaptive_spin</b>.
+ * @since 21
+ */
+FFRT_C_API int ffrt_rwlockattr_setpolicy(ffrt_rwlockattr_t* attr, int policy);
+
+/**
+ * @brief Gets the waiting policy of a rwlock attribute.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @param policy Indicates a pointer to the lock policy.
+ * @return Returns <b>ffrt_success</b> if the rwlock attribute policy is get successfully;
+           returns <b>ffrt_error_inval</b> if <b>attr</b> or <b>policy</b> is a null pointer.
+ * @since 21
+ */
+FFRT_C_API int ffrt_rwlockattr_getpolicy(ffrt_rwlockattr_t* attr, int* policy);
+
+/**
+ * @brief Destroys a rwlock attribute.
+ *
+ * @param attr Indicates a pointer to the rwlock attribute.
+ * @return Returns <b>ffrt_success</b> if the rwlock attribute is destroyed;
+           returns <b>ffrt_error_inval</b> otherwise.
+ * @since 21
+ */
+FFRT_C_API int ffrt_rwlockattr_destroy(ffrt_rwlockattr_t* attr);
+
 /**
  * @brief Initializes a rwlock.
  *
@@ -148,6 +148,77 @@ FFRT_C_API void ffrt_task_attr_set_stack_size(ffrt_task_attr_t* attr, uint64_t s
  */
 FFRT_C_API uint64_t ffrt_task_attr_get_stack_size(const ffrt_task_attr_t* attr);
 
+/**
+ * @brief Sets the deadline of a task attribute.
+ *
+ * Tasks with a deadline are distributed earliest-deadline-first ahead of tasks without one
+ * of the same QoS, and ahead of priority order in a queue using <b>ffrt_queue_sched_deadline</b>.
+ * A missed deadline is counted and reported per queue for queue tasks, see
+ * <b>ffrt_queue_get_deadline_stat</b>, and per QoS for other tasks, see <b>ffrt_qos_get_deadline_stat</b>.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param deadline_us Indicates the absolute deadline on the CLOCK_MONOTONIC time base, in microseconds.
+ *                    <b>0</b> means the task has no deadline.
+ * @since 21
+ */
+FFRT_C_API void ffrt_task_attr_set_deadline(ffrt_task_attr_t* attr, uint64_t deadline_us);
+
+/**
+ * @brief Gets the deadline of a task attribute.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return Returns the absolute deadline, in microseconds, which is <b>0</b> by default.
+ * @since 21
+ */
+FFRT_C_API uint64_t ffrt_task_attr_get_deadline(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Sets the estimated execution cost of a task attribute.
+ *
+ * The scheduler distributes a deadline task no later than its deadline minus its estimated cost.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @param cost_us Indicates the estimated execution time, in microseconds.
+ * @since 21
+ */
+FFRT_C_API void ffrt_task_attr_set_estimated_cost(ffrt_task_attr_t* attr, uint64_t cost_us);
+
+/**
+ * @brief Gets the estimated execution cost of a task attribute.
+ *
+ * @param attr Indicates a pointer to the task attribute.
+ * @return Returns the estimated execution time, in microseconds, which is <b>0</b> by default.
+ * @since 21
+ */
+FFRT_C_API uint64_t ffrt_task_attr_get_estimated_cost(const ffrt_task_attr_t* attr);
+
+/**
+ * @brief Sets the deadline miss callback of a QoS.
+ *
+ * The callback is invoked on the worker thread right after a task of the QoS that was not submitted to a queue
+ * finishes later than its deadline. Queue tasks are reported by the callback of their queue instead.
+ *
+ * @warning Do not block in `cb` - this delays the following tasks of the worker.
+ * @param qos Indicates the QoS.
+ * @param cb Indicates the deadline miss callback, or a null pointer to unregister.
+ * @param data Indicates the user data passed to the callback.
+ * @return Returns <b>ffrt_success</b> if the callback is set;
+           returns <b>ffrt_error_inval</b> if <b>qos</b> is invalid.
+ * @since 21
+ */
+FFRT_C_API int ffrt_qos_set_deadline_miss_callback(ffrt_qos_t qos, ffrt_deadline_miss_cb cb, void* data);
+
+/**
+ * @brief Gets the deadline statistics of the tasks of a QoS that were not submitted to a queue.
+ *
+ * @param qos Indicates the QoS.
+ * @param stat Indicates a pointer to the statistics to be filled in.
+ * @return Returns <b>ffrt_success</b> if the statistics are obtained;
+           returns <b>ffrt_error_inval</b> if <b>qos</b> or <b>stat</b> is invalid.
+ * @since 21
+ */
+FFRT_C_API int ffrt_qos_get_deadline_stat(ffrt_qos_t qos, ffrt_deadline_stat_t* stat);
+
 /**
  * @brief Updates the QoS of this task.
  *
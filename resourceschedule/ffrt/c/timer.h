@@ -65,5 +65,41 @@ FFRT_C_API ffrt_timer_t ffrt_timer_start(ffrt_qos_t qos, uint64_t timeout, void*
  */
 FFRT_C_API int ffrt_timer_stop(ffrt_qos_t qos, ffrt_timer_t handle);
 
+/**
+ * @brief Sets the tick resolution of the timers on ffrt worker.
+ *
+ * Timers are kept in a hierarchical timing wheel, so starting and stopping a timer costs constant time
+ * regardless of the number of pending timers. Expiry time is rounded up to the tick resolution, and all
+ * timers expiring in the same tick are processed in one batch. The new resolution applies to timers
+ * started afterwards.
+ *
+ * @param qos Indicates qos of the worker that runs timer.
+ * @param resolution_us Indicates the tick resolution, in microseconds. The default value is 1000.
+ * @return Returns <b>ffrt_success</b> if the resolution is set;
+           returns <b>ffrt_error_inval</b> if <b>qos</b> or <b>resolution_us</b> is invalid.
+ * @since 21
+ */
+FFRT_C_API int ffrt_timer_set_resolution(ffrt_qos_t qos, uint64_t resolution_us);
+
+/**
+ * @brief Gets the tick resolution of the timers on ffrt worker.
+ *
+ * @param qos Indicates qos of the worker that runs timer.
+ * @return Returns the tick resolution, in microseconds.
+ * @since 21
+ */
+FFRT_C_API uint64_t ffrt_timer_get_resolution(ffrt_qos_t qos);
+
+/**
+ * @brief Gets the timer statistics on ffrt worker.
+ *
+ * @param qos Indicates qos of the worker that runs timer.
+ * @param stat Indicates a pointer to the statistics to be filled in.
+ * @return Returns <b>ffrt_success</b> if the statistics are obtained;
+           returns <b>ffrt_error_inval</b> if <b>qos</b> or <b>stat</b> is invalid.
+ * @since 21
+ */
+FFRT_C_API int ffrt_timer_get_stat(ffrt_qos_t qos, ffrt_timer_stat_t* stat);
+
 #endif // FFRT_API_C_TIMER_H
 /** @} */
\ No newline at end of file
@@ -61,6 +61,20 @@ typedef enum {
     ffrt_queue_priority_idle,
 } ffrt_queue_priority_t;
 
+/**
+ * @brief Enumerates the queue scheduling policies.
+ *
+ * @since 21
+ */
+typedef enum {
+    /** Tasks are sorted by priority and handle time, default policy. */
+    ffrt_queue_sched_priority = 0,
+    /** Tasks are sorted by absolute deadline, earliest deadline first.
+     *  Tasks without a deadline are distributed after all tasks that have one.
+     */
+    ffrt_queue_sched_deadline,
+} ffrt_queue_sched_policy_t;
+
 /**
  * @brief Enumerates the task QoS types.
  *
@@ -86,6 +100,59 @@ typedef enum {
  */
 typedef int ffrt_qos_t;
 
+/**
+ * @brief Defines the maximum number of CPUs that can be described by ffrt_cpu_set_t.
+ *
+ * @since 21
+ */
+#define FFRT_CPU_SET_MAX_CPUS 256
+
+/**
+ * @brief Defines the CPU set structure.
+ *
+ * Bit (n % 64) of bits[n / 64] selects CPU n.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** An array of uint64_t used to store the CPU bitmap. */
+    uint64_t bits[FFRT_CPU_SET_MAX_CPUS / 64];
+} ffrt_cpu_set_t;
+
+/**
+ * @brief Defines the CPU cluster information.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Cluster ID, read from the cluster_id of the CPU topology. */
+    uint32_t id;
+    /** Relative compute capacity of a CPU in the cluster, read from cpu_capacity, 0 if unknown. */
+    uint32_t capacity;
+    /** Maximum frequency of a CPU in the cluster, in kHz, 0 if unknown. */
+    uint32_t max_freq_khz;
+    /** CPUs in the cluster. */
+    ffrt_cpu_set_t cpus;
+} ffrt_cpu_cluster_t;
+
+/**
+ * @brief Defines the utilization statistics of a CPU cluster.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Cluster ID. */
+    uint32_t id;
+    /** Number of ffrt workers currently bound to the cluster. */
+    uint32_t workers;
+    /** Number of ffrt workers currently running a task on the cluster. */
+    uint32_t busy_workers;
+    /** Time ffrt workers spent running tasks on the cluster, in microseconds. */
+    uint64_t busy_time_us;
+    /** Time ffrt workers spent alive on the cluster, in microseconds. */
+    uint64_t alive_time_us;
+} ffrt_cluster_stat_t;
+
 /**
  * @brief Defines the task function pointer type.
  *
@@ -291,6 +358,55 @@ typedef enum {
     ffrt_mutex_default = ffrt_mutex_normal
 } ffrt_mutex_type;
 
+/**
+ * @brief Enumerates the lock waiting policies.
+ *
+ * Describes how a task waits for a contended ffrt_mutex_t or ffrt_rwlock_t. ffrt_lock_policy_park
+ * suspends the waiting task at once; ffrt_lock_policy_adaptive_spin spins for a period learned from
+ * the recent hold time of the lock before suspending, which suits short critical sections.
+ *
+ * @since 21
+ */
+typedef enum {
+    /** Suspends the waiting task at once. */
+    ffrt_lock_policy_park = 0,
+    /** Spins adaptively before suspending the waiting task. */
+    ffrt_lock_policy_adaptive_spin = 1,
+    /** Default lock policy. */
+    ffrt_lock_policy_default = ffrt_lock_policy_park
+} ffrt_lock_policy;
+
+/**
+ * @brief Defines the maximum length of the owner name recorded by the lock profiler, including the terminator.
+ *
+ * @since 21
+ */
+#define FFRT_LOCK_PROFILE_NAME_LEN 64
+
+/**
+ * @brief Defines the contention profile of a lock.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Address of the ffrt_mutex_t or ffrt_rwlock_t. */
+    const void* lock;
+    /** Number of times the lock was acquired. */
+    uint64_t acquired;
+    /** Number of acquisitions that had to wait. */
+    uint64_t contended;
+    /** Sum of the time spent waiting for the lock, in nanoseconds. */
+    uint64_t total_wait_ns;
+    /** Largest time spent waiting for the lock, in nanoseconds. */
+    uint64_t max_wait_ns;
+    /** Sum of the time the lock was held, in nanoseconds. */
+    uint64_t total_hold_ns;
+    /** Largest time the lock was held, in nanoseconds. */
+    uint64_t max_hold_ns;
+    /** Name of the task that held the lock for <b>max_hold_ns</b>. */
+    char owner_name[FFRT_LOCK_PROFILE_NAME_LEN];
+} ffrt_lock_profile_t;
+
 /**
  * @brief Defines the mutex structure.
  *
@@ -352,6 +468,52 @@ typedef void (*ffrt_timer_cb)(void* data);
  */
 typedef int ffrt_timer_t;
 
+/**
+ * @brief Defines the timer statistics of a QoS level.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Number of timers currently pending. */
+    uint64_t active;
+    /** Number of timers started since the process started. */
+    uint64_t started;
+    /** Number of timers stopped before expiry. */
+    uint64_t stopped;
+    /** Number of timer expirations, including every period of repeating timers. */
+    uint64_t expired;
+    /** Sum of the delay between expiry time and callback execution, in microseconds. */
+    uint64_t total_lag_us;
+    /** Largest delay between expiry time and callback execution, in microseconds. */
+    uint64_t max_lag_us;
+} ffrt_timer_stat_t;
+
+/**
+ * @brief Defines the deadline miss callback function type.
+ *
+ * @param data Indicates the user data passed when the callback is registered.
+ * @param task_id Indicates the ID of the task that missed its deadline.
+ * @param overrun_us Indicates how long the task finished after its deadline, in microseconds.
+ * @since 21
+ */
+typedef void (*ffrt_deadline_miss_cb)(void* data, uint64_t task_id, uint64_t overrun_us);
+
+/**
+ * @brief Defines the deadline statistics of a queue or a QoS.
+ *
+ * @since 21
+ */
+typedef struct {
+    /** Number of completed tasks that had a deadline. */
+    uint64_t completed;
+    /** Number of completed tasks that finished after their deadline. */
+    uint64_t missed;
+    /** Sum of the overrun time of all missed tasks, in microseconds. */
+    uint64_t total_overrun_us;
+    /** Largest overrun time of a single task, in microseconds. */
+    uint64_t max_overrun_us;
+} ffrt_deadline_stat_t;
+
 #ifdef __cplusplus
 namespace ffrt {
 
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup FFRT
+ * @{
+ *
+ * @brief Provides FFRT C APIs.
+ *
+ * @since 21
+ */
+
+/**
+ * @file worker_group.h
+ *
+ * @brief Declares the CPU topology and worker group interfaces in C.
+ *
+ * A worker group is the set of CPUs and the maximum number of workers used by one QoS level.
+ * The QoS values accepted here are the same as {@link QoS_Level} in qos.h, so a thread set with
+ * OH_QoS_SetThreadQoS and ffrt tasks of the same level share one worker group.
+ * The CPU topology is read from sysfs (/sys/devices/system/cpu).
+ *
+ * @library libffrt.z.so
+ * @kit FunctionFlowRuntimeKit
+ * @syscap SystemCapability.Resourceschedule.Ffrt.Core
+ * @since 21
+ */
+
+#ifndef FFRT_API_C_WORKER_GROUP_H
+#define FFRT_API_C_WORKER_GROUP_H
+
+#include <stdint.h>
+#include "type_def.h"
+
+/**
+ * @brief Gets the CPU clusters of the device.
+ *
+ * CPUs sharing the same cluster_id in sysfs form one cluster. Clusters are sorted by
+ * <b>capacity</b> in ascending order, so the last cluster is the biggest one.
+ *
+ * @param clusters Indicates an array to receive the cluster information.
+ * @param count Indicates the number of elements in <b>clusters</b>.
+ * @return Returns the number of clusters, which may exceed <b>count</b>;
+           only the first <b>count</b> clusters are written.
+ * @since 21
+ */
+FFRT_C_API uint32_t ffrt_get_cpu_clusters(ffrt_cpu_cluster_t* clusters, uint32_t count);
+
+/**
+ * @brief Sets the worker group of a QoS level.
+ *
+ * Workers of the QoS level are bound to <b>cpus</b>, and at most <b>max_workers</b> of them run at the
+ * same time. Workers already running are rebound when they pick up their next task.
+ *
+ * @param qos Indicates the QoS.
+ * @param cpus Indicates a pointer to the CPU set, or a null pointer to use all online CPUs.
+ * @param max_workers Indicates the maximum number of workers, or <b>0</b> to use the number of CPUs in the set.
+ * @return Returns <b>ffrt_success</b> if the worker group is set;
+           returns <b>ffrt_error_inval</b> if <b>qos</b> is invalid or <b>cpus</b> has no online CPU.
+ * @since 21
+ */
+FFRT_C_API int ffrt_qos_set_worker_group(ffrt_qos_t qos, const ffrt_cpu_set_t* cpus, uint32_t max_workers);
+
+/**
+ * @brief Gets the worker group of a QoS level.
+ *
+ * @param qos Indicates the QoS.
+ * @param cpus Indicates a pointer to receive the CPU set.
+ * @param max_workers Indicates a pointer to receive the maximum number of workers.
+ * @return Returns <b>ffrt_success</b> if the worker group is obtained;
+           returns <b>ffrt_error_inval</b> if <b>qos</b> is invalid or any pointer is a null pointer.
+ * @since 21
+ */
+FFRT_C_API int ffrt_qos_get_worker_group(ffrt_qos_t qos, ffrt_cpu_set_t* cpus, uint32_t* max_workers);
+
+/**
+ * @brief Gets the utilization of every CPU cluster used by ffrt workers.
+ *
+ * @param stats Indicates an array to receive the statistics, indexed in the same order as ffrt_get_cpu_clusters.
+ * @param count Indicates the number of elements in <b>stats</b>.
+ * @return Returns the number of clusters, which may exceed <b>count</b>;
+           only the first <b>count</b> statistics are written.
+ * @since 21
+ */
+FFRT_C_API uint32_t ffrt_get_cluster_stat(ffrt_cluster_stat_t* stats, uint32_t count);
+
+#endif // FFRT_API_C_WORKER_GROUP_H
+/** @} */